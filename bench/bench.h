@@ -0,0 +1,92 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 22:55
+//
+
+#ifndef AGO_NETWORK_BENCH_H
+#define AGO_NETWORK_BENCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <lib/network/router/router.h>
+#include <lib/network/dealer/dealer.h>
+
+namespace agoNetwork::bench {
+	using clock = std::chrono::steady_clock;
+
+	/// @brief Runs router::listen on a thread of its own while it is in
+	/// scope, so a dealer could talk to the router from the calling thread.
+	class listening final {
+	private:
+		router& _router;
+		std::thread _thread;
+
+	public:
+		explicit
+		listening(router& _router) noexcept
+				:_router{ _router }, _thread{ [this] { this->_router.listen(); }} {
+		}
+
+		listening(const listening&) = delete;
+
+		listening&
+		operator=(const listening&) = delete;
+
+		~listening() {
+			_router.stop();
+			_thread.join();
+		}
+	};
+
+	/// @brief Wait until the counter reaches the target or the timeout is
+	/// over.
+	/// @return true if the counter reached the target in time.
+	inline bool
+	waitFor(
+			const std::atomic<std::uint64_t>& counter,
+			std::uint64_t target,
+			std::chrono::seconds timeout = std::chrono::seconds{ 30 }) noexcept {
+		const auto expiry = clock::now()+timeout;
+		while (counter.load(std::memory_order_acquire)<target) {
+			if (clock::now()>expiry) {
+				return false;
+			}
+			std::this_thread::yield();
+		}
+		return true;
+	}
+
+	/// @brief Print the throughput of a run.
+	inline void
+	throughput(const char* name, std::uint64_t messages, clock::duration elapsed)
+	noexcept {
+		const auto seconds = std::chrono::duration<double>(elapsed).count();
+		std::printf("%-28s %10llu messages %12.0f messages/s\n",
+				name, static_cast<unsigned long long>(messages),
+				seconds>0 ? static_cast<double>(messages)/seconds : 0.0);
+	}
+
+	/// @brief Print the p50 and p99 of the latencies of a run.
+	inline void
+	latency(const char* name, std::vector<clock::duration> samples) noexcept {
+		if (samples.empty()) {
+			std::printf("%-28s no samples\n", name);
+			return;
+		}
+		std::sort(samples.begin(), samples.end());
+		const auto percentile = [&](double rank) {
+			const auto index = static_cast<std::size_t>(rank*static_cast<double>(samples.size()-1));
+			return std::chrono::duration<double, std::micro>(samples[index]).count();
+		};
+		std::printf("%-28s %10zu samples  p50 %9.2f us  p99 %9.2f us\n",
+				name, samples.size(), percentile(0.50), percentile(0.99));
+	}
+}
+
+#endif //AGO_NETWORK_BENCH_H
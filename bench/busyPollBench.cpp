@@ -0,0 +1,54 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 23:15
+//
+
+#include <bench/bench.h>
+
+using namespace agoNetwork;
+using namespace agoNetwork::literals;
+using namespace std::chrono_literals;
+
+namespace {
+	/// Round trips which are not measured.
+	constexpr std::size_t warmup{ 1'000 };
+	/// Round trips of each run.
+	constexpr std::size_t requests{ 20'000 };
+
+	/// @brief Measure the round trips of dealer::request to an echoing
+	/// router, both of them spin for the specified period (zero blocks).
+	void
+	run(const char* name, std::chrono::microseconds spin) {
+		auto context = std::make_shared<zmq::context_t>(1);
+		router server{ context, socketModel::inproc{ "bench", "bench" }};
+		server.registerCallback("bench"_inproc,
+				[](const std::shared_ptr<inprocSocket>& socket, const std::vector<std::string>& req) {
+					socket->send(req[0], req[1]);
+				});
+		server.busyPoll({ .spin = spin, .cpus = {} });
+		const bench::listening listening{ server };
+		dealer client{ context, socketModel::inproc{ "bench", "bench" }};
+		client.busyPoll({ .spin = spin, .cpus = {} });
+		const std::string payload(64, 'x');
+		for (std::size_t request{ 0 }; request<warmup; ++request) {
+			client.request("bench"_inproc, payload, 1s);
+		}
+		std::vector<bench::clock::duration> samples;
+		samples.reserve(requests);
+		for (std::size_t request{ 0 }; request<requests; ++request) {
+			const auto begin = bench::clock::now();
+			if (client.request("bench"_inproc, payload, 1s)) {
+				samples.push_back(bench::clock::now()-begin);
+			}
+		}
+		bench::latency(name, std::move(samples));
+	}
+}
+
+int
+main() {
+	run("blocking poll", 0us);
+	run("busy poll of 100us", 100us);
+	return 0;
+}
@@ -0,0 +1,65 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 23:40
+//
+
+#include <bench/bench.h>
+#include <lib/network/codec/codec.h>
+
+using namespace agoNetwork;
+
+namespace {
+	/// Encodings and decodings of each run.
+	constexpr std::uint64_t operations{ 5'000'000 };
+
+	struct fixedOrder {
+		std::uint64_t id;
+		std::int32_t quantity;
+		double price;
+		char symbol[8];
+	};
+
+	struct order {
+		std::uint64_t id{ 0 };
+		std::int32_t quantity{ 0 };
+		double price{ 0 };
+		std::string_view symbol;
+		static constexpr auto fields = std::make_tuple(
+				&order::id, &order::quantity, &order::price, &order::symbol);
+	};
+
+	/// @brief Encode the message and decode it again, the decoded messages
+	/// are summed up so none of them is optimized away.
+	template<typename message_t, typename codec_t>
+	void
+	run(const char* name, const message_t& message) {
+		std::uint64_t sum{ 0 };
+		auto begin = bench::clock::now();
+		for (std::uint64_t operation{ 0 }; operation<operations; ++operation) {
+			sum += encoded<message_t, codec_t>(message).size();
+		}
+		const auto encoding = bench::clock::now()-begin;
+		const auto frame = encoded<message_t, codec_t>(message);
+		begin = bench::clock::now();
+		for (std::uint64_t operation{ 0 }; operation<operations; ++operation) {
+			if (const auto decoded = codec_t::decode(frame)) {
+				sum += decoded->id;
+			}
+		}
+		const auto decoding = bench::clock::now()-begin;
+		bench::throughput((std::string{ name }+" encode").c_str(), operations, encoding);
+		bench::throughput((std::string{ name }+" decode").c_str(), operations, decoding);
+		std::printf("%-28s %10zu bytes (checksum %llu)\n", name, frame.size(),
+				static_cast<unsigned long long>(sum));
+	}
+}
+
+int
+main() {
+	run<fixedOrder, fixedCodec<fixedOrder>>("fixedCodec",
+			fixedOrder{ 42, -7, 42.125, "AGO" });
+	run<order, varintCodec<order>>("varintCodec",
+			order{ .id = 42, .quantity = -7, .price = 42.125, .symbol = "AGO" });
+	return 0;
+}
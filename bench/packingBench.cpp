@@ -0,0 +1,54 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 23:05
+//
+
+#include <bench/bench.h>
+
+using namespace agoNetwork;
+using namespace agoNetwork::literals;
+using namespace std::chrono_literals;
+
+namespace {
+	/// Messages of each run.
+	constexpr std::uint64_t messages{ 500'000 };
+	/// Size of each message, packing pays off for tens of bytes.
+	constexpr std::size_t payloadSize{ 32 };
+
+	/// @brief Send the messages packed by the specified count, below two
+	/// sends each message in a frame of its own.
+	void
+	run(dealer& client, std::atomic<std::uint64_t>& received, std::size_t count) {
+		client.pack("bench"_inproc, count, 1ms);
+		const std::string payload(payloadSize, 'x');
+		const auto target = received.load()+messages;
+		const auto begin = bench::clock::now();
+		for (std::uint64_t message{ 0 }; message<messages; ++message) {
+			client.send("bench"_inproc, payload);
+		}
+		client.flush("bench"_inproc);
+		if (bench::waitFor(received, target)) {
+			const auto name = count>1 ? "packed by "+std::to_string(count) : std::string{ "unpacked" };
+			bench::throughput(name.c_str(), messages, bench::clock::now()-begin);
+		}
+	}
+}
+
+int
+main() {
+	auto context = std::make_shared<zmq::context_t>(1);
+	router server{ context, socketModel::inproc{ "bench", "bench" }};
+	std::atomic<std::uint64_t> received{ 0 };
+	// the router splits the packed frames, so each message is counted
+	server.registerCallback("bench"_inproc,
+			[&received](const std::shared_ptr<inprocSocket>&, const std::vector<std::string>&) {
+				received.fetch_add(1, std::memory_order_release);
+			});
+	const bench::listening listening{ server };
+	dealer client{ context, socketModel::inproc{ "bench", "bench" }};
+	for (const auto count : { 0, 16, 64, 256 }) {
+		run(client, received, count);
+	}
+	return 0;
+}
@@ -0,0 +1,66 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 22:55
+//
+
+#include <bench/bench.h>
+
+using namespace agoNetwork;
+using namespace agoNetwork::literals;
+
+namespace {
+	/// Messages of each run.
+	constexpr std::uint64_t messages{ 200'000 };
+	/// Size of each message.
+	constexpr std::size_t payloadSize{ 64 };
+
+	/// @brief Send every message by dealer::send.
+	void
+	one(dealer& client, std::atomic<std::uint64_t>& received) {
+		const std::string payload(payloadSize, 'x');
+		const auto target = received.load()+messages;
+		const auto begin = bench::clock::now();
+		for (std::uint64_t message{ 0 }; message<messages; ++message) {
+			client.send("bench"_inproc, payload);
+		}
+		if (bench::waitFor(received, target)) {
+			bench::throughput("send", messages, bench::clock::now()-begin);
+		}
+	}
+
+	/// @brief Send the messages by dealer::sendBatch, the specified number
+	/// of them at once.
+	void
+	batch(dealer& client, std::atomic<std::uint64_t>& received, std::size_t size) {
+		const std::vector<std::string> payloads(size, std::string(payloadSize, 'x'));
+		const auto batches = messages/size;
+		const auto target = received.load()+batches*size;
+		const auto begin = bench::clock::now();
+		for (std::uint64_t sent{ 0 }; sent<batches; ++sent) {
+			client.sendBatch("bench"_inproc, payloads);
+		}
+		if (bench::waitFor(received, target)) {
+			const auto name = "sendBatch of "+std::to_string(size);
+			bench::throughput(name.c_str(), batches*size, bench::clock::now()-begin);
+		}
+	}
+}
+
+int
+main() {
+	auto context = std::make_shared<zmq::context_t>(1);
+	router server{ context, socketModel::inproc{ "bench", "bench" }};
+	std::atomic<std::uint64_t> received{ 0 };
+	server.registerCallback("bench"_inproc,
+			[&received](const std::shared_ptr<inprocSocket>&, const std::vector<std::string>&) {
+				received.fetch_add(1, std::memory_order_release);
+			});
+	const bench::listening listening{ server };
+	dealer client{ context, socketModel::inproc{ "bench", "bench" }};
+	one(client, received);
+	for (const auto size : { 16, 64, 256 }) {
+		batch(client, received, size);
+	}
+	return 0;
+}
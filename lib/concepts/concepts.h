@@ -8,7 +8,10 @@
 #ifndef AGO_NETWORK_CONCEPTS_H
 #define AGO_NETWORK_CONCEPTS_H
 
+#include <optional>
+#include <ranges>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <lib/network/socket/socket.h>
 
@@ -32,6 +35,64 @@ concept routerCallback = (
 				const std::vector<std::string>&>
 		) && ...);
 
+// pullerCallback -> std::invocable
+// void (
+//          const std::vector<std::string> &
+//        )
+template<typename... Callback>
+concept pullerCallback = (
+		(std::is_invocable_r_v<
+				void,
+				Callback,
+				const std::vector<std::string>&>
+		) && ...);
+
+// messageCodec -> a type with the static functions
+// std::optional<Message> decode(std::string_view)
+// void encode(const Message &, std::string &)
+template<typename Codec, typename Message>
+concept messageCodec = requires(
+		std::string_view frame,
+		const Message& message,
+		std::string& buffer) {
+	{ Codec::decode(frame) } -> std::same_as<std::optional<Message>>;
+	{ Codec::encode(message, buffer) } -> std::same_as<void>;
+};
+
+// typedCallback -> std::invocable
+// void (
+//          std::shared_ptr<agoNetwork::tcpSocket>
+//              (or ipcSocket or inprocSocket),
+//          const std::string & (client address),
+//          const Message &
+//        )
+template<typename Callback, typename Message>
+concept typedCallback = (
+		std::is_invocable_v<
+				Callback,
+				const std::shared_ptr<agoNetwork::tcpSocket>&,
+				const std::string&,
+				const Message&>
+				|| std::is_invocable_v<
+						Callback,
+						const std::shared_ptr<agoNetwork::ipcSocket>&,
+						const std::string&,
+						const Message&>
+				|| std::is_invocable_v<
+						Callback,
+						const std::shared_ptr<agoNetwork::inprocSocket>&,
+						const std::string&,
+						const Message&>);
+
+// payloadRange -> std::ranges::input_range
+// of elements convertible to std::string_view
+template<typename Range>
+concept payloadRange = (
+		std::ranges::input_range<Range>
+				&& std::is_convertible_v<
+						std::ranges::range_reference_t<Range>,
+						std::string_view>);
+
 // socket
 template<typename... T>
 concept Socket = (
@@ -0,0 +1,127 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:20
+//
+
+#include <lib/network/admission/admission.h>
+
+namespace agoNetwork {
+	admission::
+	admission(
+			const std::vector<std::string>& sockets,
+			std::size_t perSocket,
+			std::size_t global,
+			overloadPolicy policy,
+			std::string busyReply) noexcept
+			:_perSocket{ perSocket },
+			 _global{ global },
+			 _policy{ policy },
+			 _busyReply{ std::move(busyReply) } {
+		for (const auto& socket : sockets) {
+			_depths[socket] = 0;
+		}
+	}
+
+	bool admission::
+	full(const std::string& name) const noexcept {
+		return socketFull(name) || (_global>0 && _depth>=_global);
+	}
+
+	bool admission::
+	socketFull(const std::string& name) const noexcept {
+		return _perSocket>0 && depth(name)>=_perSocket;
+	}
+
+	std::shared_ptr<void> admission::
+	admit(const std::string& name, std::function<void()> released) noexcept {
+		const auto socket = _depths.find(name);
+		if (socket==_depths.end()) {
+			return nullptr;
+		}
+		auto& depth = socket->second;
+		++depth;
+		++_depth;
+		return std::shared_ptr<void>{
+				nullptr,
+				[&depth, &total = _depth, self = weak_from_this().lock(),
+						released = std::move(released)](void*) {
+					--depth;
+					--total;
+					if (released) {
+						released();
+					}
+				}};
+	}
+
+	bool admission::
+	paused(const std::string& name) const noexcept {
+		return _policy==overloadPolicy::backpressure && full(name);
+	}
+
+	std::pair<admission::verdict, std::shared_ptr<void>> admission::
+	offer(
+			const std::string& name,
+			const std::function<bool(const std::string&)>& evictOldest,
+			std::function<void()> released) noexcept {
+		if (full(name)) {
+			switch (_policy) {
+			case overloadPolicy::reject: {
+				reject();
+				return { verdict::rejected, nullptr };
+			}
+			case overloadPolicy::dropOldest: {
+				drop();
+				// the oldest request of the socket makes room for the new one,
+				// or the oldest of any socket if only the global limit is hit
+				const auto group = socketFull(name) ? name : std::string{};
+				if (not evictOldest || not evictOldest(group)) {
+					// nothing is queued, so the new request is dropped
+					return { verdict::dropped, nullptr };
+				}
+				break;
+			}
+			case overloadPolicy::backpressure: {
+				// the socket is paused on the next poll
+				break;
+			}
+			}
+		}
+		return { verdict::admitted, admit(name, std::move(released)) };
+	}
+
+	void admission::
+	reject() noexcept {
+		++_rejected;
+	}
+
+	void admission::
+	drop() noexcept {
+		++_dropped;
+	}
+
+	overloadPolicy admission::
+	policy() const noexcept {
+		return _policy;
+	}
+
+	const std::string& admission::
+	busyReply() const noexcept {
+		return _busyReply;
+	}
+
+	std::size_t admission::
+	depth(const std::string& name) const noexcept {
+		const auto socket = _depths.find(name);
+		return socket==_depths.end() ? 0 : socket->second.load();
+	}
+
+	admission::statistics admission::
+	stats() const noexcept {
+		return {
+				_depth.load(),
+				_rejected.load(),
+				_dropped.load()
+		};
+	}
+}
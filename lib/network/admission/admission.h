@@ -0,0 +1,162 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:20
+//
+
+#ifndef AGO_NETWORK_ADMISSION_H
+#define AGO_NETWORK_ADMISSION_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief Represents what happens to a request which arrives while the
+	/// inflight queues are full.
+	enum class overloadPolicy {
+		/// Reply the busy message right away.
+		reject,
+		/// Drop the oldest queued request in favor of the new one.
+		dropOldest,
+		/// Stop polling the socket until the queue drains, so the messages
+		/// pile up in zmq and eventually push back on the senders.
+		backpressure,
+	};
+
+	/// @brief **admission** bounds the number of inflight requests
+	/// (received but not handled yet) per socket and in total.
+	class admission final : public std::enable_shared_from_this<admission> {
+	public: // public data
+		/// @brief What happens to an offered request.
+		enum class verdict {
+			/// It is inflight until its ticket is released.
+			admitted,
+			/// The busy message should be replied.
+			rejected,
+			/// It is dropped without a reply.
+			dropped,
+		};
+
+		/// @brief Overload counters.
+		struct statistics {
+			/// Number of the inflight requests.
+			std::size_t inflight{ 0 };
+			/// Number of the rejected requests.
+			std::uint64_t rejected{ 0 };
+			/// Number of the dropped requests.
+			std::uint64_t dropped{ 0 };
+		};
+
+	private: // private data
+		/// Maximum number of the inflight requests of each socket.
+		std::size_t _perSocket;
+		/// Maximum number of the inflight requests in total.
+		std::size_t _global;
+		/// What happens to the requests beyond the limits.
+		overloadPolicy _policy;
+		/// The reply of the rejected requests.
+		std::string _busyReply;
+		/// Maps socket name to its number of the inflight requests.
+		/// Sockets are inserted before listening, so lookups are lock free.
+		std::unordered_map<std::string, std::atomic<std::size_t>> _depths;
+		/// Number of the inflight requests in total.
+		std::atomic<std::size_t> _depth{ 0 };
+		/// Number of the rejected requests.
+		std::atomic<std::uint64_t> _rejected{ 0 };
+		/// Number of the dropped requests.
+		std::atomic<std::uint64_t> _dropped{ 0 };
+
+	public: // constructors and destructors
+		/// @brief Initialize the limits.
+		/// @param sockets Names of the sockets.
+		/// @param perSocket Limit of each socket, zero means unbounded.
+		/// @param global Limit of all sockets, zero means unbounded.
+		/// @param policy What happens to the requests beyond the limits.
+		/// @param busyReply The reply of the rejected requests.
+		explicit
+		admission(
+				const std::vector<std::string>& sockets,
+				std::size_t perSocket,
+				std::size_t global,
+				overloadPolicy policy,
+				std::string busyReply) noexcept;
+
+	public: // public methods
+		/// @brief Specify whether the socket could not take one more request.
+		/// @return true if either of the limits is reached.
+		[[nodiscard]]
+		bool
+		full(const std::string&) const noexcept;
+
+		/// @brief Specify whether the socket limit itself is reached.
+		/// @return true if the socket limit is reached.
+		[[nodiscard]]
+		bool
+		socketFull(const std::string&) const noexcept;
+
+		/// @brief Specify whether polling the socket should be paused by
+		/// the backpressure policy.
+		[[nodiscard]]
+		bool
+		paused(const std::string&) const noexcept;
+
+		/// @brief Count a request of the socket as inflight.
+		/// The ticket keeps the admission alive (if it is owned by a shared
+		/// pointer), so the admission could be replaced while the tickets
+		/// of its requests are still around.
+		/// @param released Called once the request is released.
+		/// @return A ticket which releases the request once it is destroyed,
+		/// whether the request is handled or dropped.
+		[[nodiscard]]
+		std::shared_ptr<void>
+		admit(const std::string&, std::function<void()> released) noexcept;
+
+		/// @brief Apply the policy to a request of the socket and admit it
+		/// unless it is rejected or dropped.
+		/// @param evictOldest Removes the oldest queued request of a socket
+		/// (or of any socket, if the name is empty) for the dropOldest
+		/// policy, it returns false if nothing is queued.
+		/// @param released Called once the request is released.
+		/// @return The verdict and the ticket of an admitted request.
+		std::pair<verdict, std::shared_ptr<void>>
+		offer(
+				const std::string&,
+				const std::function<bool(const std::string&)>& evictOldest,
+				std::function<void()> released) noexcept;
+
+		/// @brief Count a rejected request.
+		void
+		reject() noexcept;
+
+		/// @brief Count a dropped request.
+		void
+		drop() noexcept;
+
+		/// @brief Specify the overload policy.
+		[[nodiscard]]
+		overloadPolicy
+		policy() const noexcept;
+
+		/// @brief Specify the reply of the rejected requests.
+		[[nodiscard]]
+		const std::string&
+		busyReply() const noexcept;
+
+		/// @brief Specify the number of the inflight requests of a socket.
+		[[nodiscard]]
+		std::size_t
+		depth(const std::string&) const noexcept;
+
+		/// @brief Specify the overload counters.
+		[[nodiscard]]
+		statistics
+		stats() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_ADMISSION_H
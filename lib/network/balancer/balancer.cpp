@@ -0,0 +1,163 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:41
+//
+
+#include <algorithm>
+#include <lib/network/balancer/balancer.h>
+
+namespace agoNetwork {
+	balancer::
+	balancer(
+			const std::vector<std::string>& endpoints,
+			balancePolicy policy,
+			balanceOptions _options) noexcept
+			:_policy{ policy },
+			 _options{ _options } {
+		for (const auto& name : endpoints) {
+			_endpoints.push_back(endpoint{ name });
+		}
+	}
+
+	bool balancer::
+	available_(const endpoint& _endpoint, clock::time_point now) noexcept {
+		return now>=_endpoint.ejectedUntil
+				&& not (_endpoint.probing && _endpoint.outstanding>0);
+	}
+
+	balancer::endpoint* balancer::
+	find_(const std::string& name) noexcept {
+		const auto found = std::find_if(
+				_endpoints.begin(), _endpoints.end(),
+				[&name](const endpoint& _endpoint) {
+					return _endpoint.name==name;
+				});
+		return found==_endpoints.end() ? nullptr : &*found;
+	}
+
+	std::optional<std::string> balancer::
+	pick(const std::string& except) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto now = clock::now();
+		std::vector<std::size_t> candidates;
+		for (std::size_t index{ 0 }; index<_endpoints.size(); ++index) {
+			if (available_(_endpoints[index], now)
+					&& _endpoints[index].name!=except) {
+				candidates.push_back(index);
+			}
+		}
+		if (candidates.empty()) {
+			// every endpoint is ejected or excepted, so try them all
+			for (std::size_t index{ 0 }; index<_endpoints.size(); ++index) {
+				if (_endpoints[index].name!=except || _endpoints.size()==1) {
+					candidates.push_back(index);
+				}
+			}
+		}
+		if (candidates.empty()) {
+			return std::nullopt;
+		}
+		std::size_t picked{ candidates.front() };
+		switch (_policy) {
+		case balancePolicy::roundRobin: {
+			picked = candidates[_next++%candidates.size()];
+			break;
+		}
+		case balancePolicy::leastOutstanding: {
+			// ties are broken in turn so idle endpoints share the load
+			const auto offset = _next++;
+			for (std::size_t index{ 0 }; index<candidates.size(); ++index) {
+				const auto candidate =
+						candidates[(offset+index)%candidates.size()];
+				if (index==0 || _endpoints[candidate].outstanding
+						<_endpoints[picked].outstanding) {
+					picked = candidate;
+				}
+			}
+			break;
+		}
+		case balancePolicy::powerOfTwo: {
+			if (candidates.size()==1) {
+				break;
+			}
+			std::uniform_int_distribution<std::size_t> random{
+					0, candidates.size()-1 };
+			const auto first = random(_random);
+			auto second = random(_random);
+			if (second==first) {
+				second = (first+1)%candidates.size();
+			}
+			// an endpoint costs its latency for each request it is
+			// already working on
+			const auto cost = [this](std::size_t index) {
+				const auto& _endpoint = _endpoints[index];
+				return (_endpoint.latency.count()+1)
+						*static_cast<std::int64_t>(_endpoint.outstanding+1);
+			};
+			picked = cost(candidates[first])<=cost(candidates[second])
+					? candidates[first]
+					: candidates[second];
+			break;
+		}
+		}
+		return _endpoints[picked].name;
+	}
+
+	void balancer::
+	sent(const std::string& name) noexcept {
+		std::lock_guard lock{ _mutex };
+		if (auto _endpoint = find_(name)) {
+			++_endpoint->outstanding;
+		}
+	}
+
+	void balancer::
+	replied(const std::string& name, std::chrono::microseconds rtt) noexcept {
+		std::lock_guard lock{ _mutex };
+		if (auto _endpoint = find_(name)) {
+			if (_endpoint->outstanding>0) {
+				--_endpoint->outstanding;
+			}
+			// exponentially weighted, each reply counts for one fifth
+			_endpoint->latency = _endpoint->latency.count()==0
+					? rtt
+					: (_endpoint->latency*4+rtt)/5;
+			_endpoint->failures = 0;
+			_endpoint->ejections = 0;
+			_endpoint->probing = false;
+		}
+	}
+
+	void balancer::
+	failed(const std::string& name) noexcept {
+		std::lock_guard lock{ _mutex };
+		if (auto _endpoint = find_(name)) {
+			if (_endpoint->outstanding>0) {
+				--_endpoint->outstanding;
+			}
+			if (_endpoint->probing
+					|| ++_endpoint->failures>=_options.failures) {
+				const auto ejection = std::min<std::chrono::milliseconds>(
+						_options.ejection*(1 << std::min<std::size_t>(
+								_endpoint->ejections, 16)),
+						_options.maxEjection);
+				_endpoint->ejectedUntil = clock::now()+ejection;
+				++_endpoint->ejections;
+				_endpoint->failures = 0;
+				_endpoint->probing = true;
+			}
+		}
+	}
+
+	const balanceOptions& balancer::
+	settings() const noexcept {
+		return _options;
+	}
+
+	std::vector<balancer::endpoint> balancer::
+	endpoints() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return _endpoints;
+	}
+}
@@ -0,0 +1,134 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:41
+//
+
+#ifndef AGO_NETWORK_BALANCER_H
+#define AGO_NETWORK_BALANCER_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief Represents how a balancer picks the endpoint of a request.
+	enum class balancePolicy {
+		/// Each endpoint in turn.
+		roundRobin,
+		/// The endpoint with the fewest requests waiting for a reply.
+		leastOutstanding,
+		/// The better of two random endpoints by their observed latency
+		/// and outstanding requests.
+		powerOfTwo,
+	};
+
+	/// @brief Ejection options of a balancer.
+	struct balanceOptions {
+		/// Number of the failures in a row which eject an endpoint.
+		std::size_t failures{ 3 };
+		/// How long the first ejection of an endpoint lasts.
+		std::chrono::milliseconds ejection{ 1000 };
+		/// Ejections never last longer than this.
+		std::chrono::milliseconds maxEjection{ 30000 };
+		/// A request not replied within this time is a failure.
+		std::chrono::milliseconds timeout{ 5000 };
+	};
+
+	/// @brief **balancer** spreads the requests of a logical endpoint over
+	/// several sockets and keeps the unhealthy ones out for a while.
+	/// An endpoint is ejected once it fails a number of requests in a row,
+	/// it is probed with a single request once its ejection is over and
+	/// ejected again (for twice as long) if the probe fails.
+	class balancer final {
+	public: // public data
+		using clock = std::chrono::steady_clock;
+
+		/// @brief An endpoint and what is observed of it.
+		struct endpoint {
+			/// Name of the socket.
+			std::string name;
+			/// Number of the requests waiting for a reply.
+			std::size_t outstanding{ 0 };
+			/// Moving average of the round trip time,
+			/// zero means nothing is observed yet.
+			std::chrono::microseconds latency{ 0 };
+			/// Number of the failures in a row.
+			std::size_t failures{ 0 };
+			/// Number of the ejections in a row.
+			std::size_t ejections{ 0 };
+			/// The endpoint is not picked before this time.
+			clock::time_point ejectedUntil{};
+			/// The endpoint is back from an ejection and only takes
+			/// a single probe request until it succeeds.
+			bool probing{ false };
+		};
+
+	private: // private data
+		std::vector<endpoint> _endpoints;
+		balancePolicy _policy;
+		balanceOptions _options;
+		/// The next endpoint of the round robin.
+		std::size_t _next{ 0 };
+		std::minstd_rand _random{ std::random_device{}() };
+		mutable std::mutex _mutex;
+
+	public: // constructors and destructors
+		/// @param endpoints Names of the sockets.
+		/// @param policy How the endpoint of a request is picked.
+		/// @param _options Ejection options.
+		balancer(
+				const std::vector<std::string>& endpoints,
+				balancePolicy policy,
+				balanceOptions _options = {}) noexcept;
+
+	private: // private methods
+		/// @brief Specify whether an endpoint could take a request.
+		[[nodiscard]]
+		static bool
+		available_(const endpoint&, clock::time_point) noexcept;
+
+		/// @brief Find an endpoint by its name.
+		/// @return The endpoint or nullptr if it is unknown.
+		endpoint*
+		find_(const std::string&) noexcept;
+
+	public: // public methods
+		/// @brief Pick the endpoint of the next request.
+		/// If every endpoint is ejected, they are all picked from anyway
+		/// rather than failing every request.
+		/// @param except An endpoint which should not be picked
+		/// unless it is the only one.
+		/// @return Name of the endpoint or nothing if there is none.
+		std::optional<std::string>
+		pick(const std::string& except = {}) noexcept;
+
+		/// @brief Count a request sent to an endpoint.
+		void
+		sent(const std::string&) noexcept;
+
+		/// @brief Count a reply of an endpoint and its round trip time.
+		void
+		replied(const std::string&, std::chrono::microseconds) noexcept;
+
+		/// @brief Count a failed (e.g. timed out) request of an endpoint.
+		void
+		failed(const std::string&) noexcept;
+
+		/// @brief Specify the options of the balancer.
+		[[nodiscard]]
+		const balanceOptions&
+		settings() const noexcept;
+
+		/// @brief Specify what is observed of the endpoints.
+		[[nodiscard]]
+		std::vector<endpoint>
+		endpoints() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_BALANCER_H
@@ -0,0 +1,88 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:46
+//
+
+#include <lib/network/breaker/circuitBreaker.h>
+
+namespace agoNetwork {
+	circuitBreaker::
+	circuitBreaker(breakerOptions _options) noexcept
+			:_options{ _options } { }
+
+	void circuitBreaker::
+	open_() noexcept {
+		_state = circuitState::open;
+		_openedAt = clock::now();
+		_failures = 0;
+		++_opened;
+	}
+
+	bool circuitBreaker::
+	allow() noexcept {
+		std::lock_guard lock{ _mutex };
+		if (_state==circuitState::open
+				&& clock::now()-_openedAt>=_options.open) {
+			_state = circuitState::halfOpen;
+			_probes = 0;
+			_succeeded = 0;
+		}
+		switch (_state) {
+		case circuitState::closed: {
+			return true;
+		}
+		case circuitState::halfOpen: {
+			if (_probes<_options.probes) {
+				++_probes;
+				return true;
+			}
+			break;
+		}
+		case circuitState::open: {
+			break;
+		}
+		}
+		++_rejected;
+		return false;
+	}
+
+	void circuitBreaker::
+	cancel() noexcept {
+		std::lock_guard lock{ _mutex };
+		if (_state==circuitState::halfOpen && _probes>0) {
+			--_probes;
+		}
+	}
+
+	void circuitBreaker::
+	success() noexcept {
+		std::lock_guard lock{ _mutex };
+		_failures = 0;
+		if (_state==circuitState::halfOpen
+				&& ++_succeeded>=_options.probes) {
+			_state = circuitState::closed;
+		}
+	}
+
+	void circuitBreaker::
+	failure() noexcept {
+		std::lock_guard lock{ _mutex };
+		if (_state==circuitState::halfOpen
+				|| (_state==circuitState::closed
+						&& ++_failures>=_options.failures)) {
+			open_();
+		}
+	}
+
+	const breakerOptions& circuitBreaker::
+	settings() const noexcept {
+		return _options;
+	}
+
+	circuitBreaker::statistics circuitBreaker::
+	stats() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return { _state, _opened, _rejected };
+	}
+}
@@ -0,0 +1,104 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:46
+//
+
+#ifndef AGO_NETWORK_CIRCUIT_BREAKER_H
+#define AGO_NETWORK_CIRCUIT_BREAKER_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace agoNetwork {
+	/// @brief Represents the state of a circuit breaker.
+	enum class circuitState {
+		/// Requests pass.
+		closed,
+		/// Requests fail fast.
+		open,
+		/// A few probe requests pass in order to decide whether to close.
+		halfOpen,
+	};
+
+	/// @brief Options of a circuit breaker.
+	struct breakerOptions {
+		/// Number of the failures in a row which open the circuit.
+		std::size_t failures{ 5 };
+		/// How long the circuit stays open before probing.
+		std::chrono::milliseconds open{ 5000 };
+		/// Number of the probes which should succeed to close the circuit.
+		std::size_t probes{ 1 };
+		/// A request not replied within this time is a failure.
+		std::chrono::milliseconds timeout{ 5000 };
+	};
+
+	/// @brief **circuitBreaker** fails the requests of an endpoint fast once
+	/// it keeps failing, instead of piling them up in front of it.
+	class circuitBreaker final {
+	public: // public data
+		using clock = std::chrono::steady_clock;
+
+		/// @brief What the circuit breaker did so far.
+		struct statistics {
+			circuitState state{ circuitState::closed };
+			/// Number of the times the circuit opened.
+			std::uint64_t opened{ 0 };
+			/// Number of the requests failed fast.
+			std::uint64_t rejected{ 0 };
+		};
+
+	private: // private data
+		breakerOptions _options;
+		circuitState _state{ circuitState::closed };
+		/// Number of the failures in a row.
+		std::size_t _failures{ 0 };
+		/// Number of the probes sent and succeeded since half opened.
+		std::size_t _probes{ 0 };
+		std::size_t _succeeded{ 0 };
+		clock::time_point _openedAt{};
+		std::uint64_t _opened{ 0 };
+		std::uint64_t _rejected{ 0 };
+		mutable std::mutex _mutex;
+
+	public: // constructors and destructors
+		explicit
+		circuitBreaker(breakerOptions _options = {}) noexcept;
+
+	private: // private methods
+		/// @brief Open the circuit.
+		void
+		open_() noexcept;
+
+	public: // public methods
+		/// @brief Ask whether a request could pass.
+		/// @return true if the request passes and false if it fails fast.
+		bool
+		allow() noexcept;
+
+		/// @brief Give back a passed request which is not sent after all.
+		void
+		cancel() noexcept;
+
+		/// @brief Count a replied request.
+		void
+		success() noexcept;
+
+		/// @brief Count a failed request.
+		void
+		failure() noexcept;
+
+		/// @brief Specify the options of the circuit breaker.
+		[[nodiscard]]
+		const breakerOptions&
+		settings() const noexcept;
+
+		/// @brief Specify what the circuit breaker did so far.
+		[[nodiscard]]
+		statistics
+		stats() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_CIRCUIT_BREAKER_H
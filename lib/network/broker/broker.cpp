@@ -0,0 +1,252 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 09:50
+//
+
+#include <regex>
+#include <lib/network/broker/broker.h>
+#include <lib/network/zmq/zhelpers.hpp>
+#include <lib/network/log/logger.h>
+
+namespace agoNetwork {
+	broker::
+	~broker() {
+		terminate();
+	}
+
+	void broker::
+	registerFrontend_(const socketModel::tcp& _socket) {
+		if (not validateURI_(_socket.address)) {
+			throw (std::runtime_error(
+					"Could not validate "
+							+_socket.address
+							+"\nvalid uri: ipv4:port"));
+		}
+		try {
+			_frontend->bind("tcp://"+_socket.address);
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in binding broker frontend {} on address {}, what? {}",
+					_socket.name, _socket.address, error.what());
+		}
+	}
+
+	void broker::
+	registerFrontend_(const socketModel::ipc& _socket) noexcept {
+		try {
+			_frontend->bind("ipc://"+_socket.address+".ipc");
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in binding broker frontend {} on address {}, what? {}",
+					_socket.name, _socket.address, error.what());
+		}
+	}
+
+	void broker::
+	registerFrontend_(const socketModel::inproc& _socket) noexcept {
+		try {
+			_frontend->bind("inproc://"+_socket.address+".inproc");
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in binding broker frontend {} on address {}, what? {}",
+					_socket.name, _socket.address, error.what());
+		}
+	}
+
+	void broker::
+	registerBackend_(const socketModel::tcp& _socket) {
+		if (not validateURI_(_socket.address)) {
+			throw (std::runtime_error(
+					"Could not validate "
+							+_socket.address
+							+"\nvalid uri: ipv4:port"));
+		}
+		try {
+			_backend->connect("tcp://"+_socket.address);
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in connecting broker backend {} on address {}, what? {}",
+					_socket.name, _socket.address, error.what());
+		}
+	}
+
+	void broker::
+	registerBackend_(const socketModel::ipc& _socket) noexcept {
+		try {
+			_backend->connect("ipc://"+_socket.address+".ipc");
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in connecting broker backend {} on address {}, what? {}",
+					_socket.name, _socket.address, error.what());
+		}
+	}
+
+	void broker::
+	registerBackend_(const socketModel::inproc& _socket) noexcept {
+		try {
+			_backend->connect("inproc://"+_socket.address+".inproc");
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in connecting broker backend {} on address {}, what? {}",
+					_socket.name, _socket.address, error.what());
+		}
+	}
+
+	bool broker::
+	validateURI_(const std::string& uri) const noexcept {
+		std::regex tcpAddress{
+				"^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\\.){3}"
+				"([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])):([0-9]+)$"
+		};
+		return (std::regex_search(uri.c_str(), tcpAddress));
+	}
+
+	void broker::
+	steer_(const std::string& command) noexcept {
+		std::lock_guard lock{ _controlMutex };
+		if (_control) {
+			s_send(*_control, command);
+		}
+	}
+
+	void broker::
+	count_() noexcept {
+		zmq::socket_t capture{ _context, ZMQ_SUB };
+		try {
+			capture.setsockopt(ZMQ_SUBSCRIBE, "", 0);
+			capture.connect(_captureAddress);
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in connecting to the broker capture {}, what? {}",
+					_captureAddress, error.what());
+			capture.setsockopt(ZMQ_LINGER, 0);
+			return;
+		}
+		std::vector<zmq::pollitem_t> polls{
+				zmq::pollitem_t{ static_cast<void*>(capture), 0, ZMQ_POLLIN, 0 }
+		};
+		while (_counting) {
+			try {
+				// wake up periodically in order to honor broker::terminate
+				zmq::poll(polls, 100);
+				if (polls.front().revents & ZMQ_POLLIN) {
+					zmq::message_t frame;
+					while (capture.recv(frame, zmq::recv_flags::dontwait)) {
+						++_frames;
+						_bytes += frame.size();
+						if (not frame.more()) {
+							++_messages;
+						}
+					}
+				}
+			}
+			catch (zmq::error_t& error) {
+				if (error.num()!=ETERM) {
+					logger::error("Error in counting broker messages, what? {}", error.what());
+				}
+				break;
+			}
+			catch (...) {
+				logger::error("Unknown error in counting broker messages");
+				break;
+			}
+		}
+		capture.setsockopt(ZMQ_LINGER, 0);
+	}
+
+	void broker::
+	start() noexcept {
+		if (_status!=brokerStatus::initialized) {
+			return;
+		}
+		const auto endpoint = "inproc://broker."+std::to_string(_started++);
+		std::shared_ptr<zmq::socket_t> controller;
+		try {
+			// a publisher drops the copies which the counter does not keep
+			// up with, a pair would block the proxy instead
+			_capture = std::make_shared<zmq::socket_t>(_context, ZMQ_PUB);
+			_capture->setsockopt(ZMQ_LINGER, 0);
+			_capture->setsockopt(ZMQ_SNDHWM, 10000);
+			_capture->bind(endpoint+".capture");
+			_control = std::make_shared<zmq::socket_t>(_context, ZMQ_PAIR);
+			_control->setsockopt(ZMQ_LINGER, 0);
+			_control->bind(endpoint+".control");
+			controller = std::make_shared<zmq::socket_t>(_context, ZMQ_PAIR);
+			controller->setsockopt(ZMQ_LINGER, 0);
+			controller->connect(endpoint+".control");
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in starting broker on {}, what? {}", endpoint, error.what());
+			std::lock_guard lock{ _controlMutex };
+			_capture.reset();
+			_control.reset();
+			return;
+		}
+		_captureAddress = endpoint+".capture";
+		_counting = true;
+		_counter = std::thread{ [&] {
+			count_();
+		}};
+		_proxy = std::thread{ [&, controller] {
+			try {
+				zmq::proxy_steerable(
+						static_cast<void*>(*_frontend),
+						static_cast<void*>(*_backend),
+						static_cast<void*>(*_capture),
+						static_cast<void*>(*controller));
+			}
+			catch (zmq::error_t& error) {
+				logger::error("Error in broker proxy, what? {}", error.what());
+			}
+		}};
+		_status = brokerStatus::running;
+	}
+
+	void broker::
+	pause() noexcept {
+		if (auto status = brokerStatus::running;
+				_status.compare_exchange_strong(status, brokerStatus::paused)) {
+			steer_("PAUSE");
+		}
+	}
+
+	void broker::
+	resume() noexcept {
+		if (auto status = brokerStatus::paused;
+				_status.compare_exchange_strong(status, brokerStatus::running)) {
+			steer_("RESUME");
+		}
+	}
+
+	void broker::
+	terminate() noexcept {
+		auto status = _status.load();
+		while (status==brokerStatus::running || status==brokerStatus::paused) {
+			// only one of the racing callers terminates the proxy
+			if (not _status.compare_exchange_weak(status, brokerStatus::terminated)) {
+				continue;
+			}
+			steer_("TERMINATE");
+			if (_proxy.joinable()) {
+				_proxy.join();
+			}
+			_counting = false;
+			if (_counter.joinable()) {
+				_counter.join();
+			}
+			_frontend->setsockopt(ZMQ_LINGER, 0);
+			_backend->setsockopt(ZMQ_LINGER, 0);
+			break;
+		}
+	}
+
+	broker::traffic broker::
+	statistics() const noexcept {
+		return {
+				_messages.load(),
+				_frames.load(),
+				_bytes.load()
+		};
+	}
+}
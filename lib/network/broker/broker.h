@@ -0,0 +1,181 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 09:50
+//
+
+#ifndef AGO_NETWORK_BROKER_H
+#define AGO_NETWORK_BROKER_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <lib/concepts/concepts.h>
+#include <lib/network/zmq/zmqContext.h>
+
+namespace agoNetwork {
+	/// @brief **broker** forwards the requests of dealers to routers
+	/// and their replies back by the *zmq steerable proxy*.
+	///
+	/// dealers -> frontend (router) -> backend (dealer) -> routers
+	///
+	/// Forwarding is done entirely inside the libzmq I/O threads.
+	/// A capture socket counts the forwarded traffic and a control socket
+	/// pauses, resumes or terminates the proxy.
+	/// The capture socket publishes the copies of the messages, so a
+	/// counter which lags behind makes it drop copies instead of stalling
+	/// the forwarding, the counters are then lower than the traffic.
+	class broker final : private zmqContext {
+	public: // public data
+		/// @brief Traffic counters of the forwarded messages
+		/// in both directions.
+		struct traffic {
+			/// Number of the forwarded multipart messages.
+			std::uint64_t messages{ 0 };
+			/// Number of the forwarded frames.
+			std::uint64_t frames{ 0 };
+			/// Number of the forwarded bytes.
+			std::uint64_t bytes{ 0 };
+		};
+
+	private: // private data
+		/// The router socket which dealers connect to.
+		std::shared_ptr<zmq::socket_t> _frontend;
+		/// The dealer socket which connects to the routers.
+		/// Requests are load balanced between the connected routers.
+		std::shared_ptr<zmq::socket_t> _backend;
+		/// The capture socket which the proxy copies all messages to.
+		std::shared_ptr<zmq::socket_t> _capture;
+		/// The inproc endpoint of the capture socket, unique per broker so
+		/// brokers could share a context.
+		std::string _captureAddress;
+		/// Number of the brokers started so far, names their endpoints.
+		static inline std::atomic<std::uint64_t> _started{ 0 };
+		/// The control socket which steers the proxy.
+		std::shared_ptr<zmq::socket_t> _control;
+		/// The control socket is used by the calling threads.
+		std::mutex _controlMutex;
+		/// Runs the proxy.
+		std::thread _proxy;
+		/// Counts the captured messages.
+		std::thread _counter;
+		/// Specify whether the counter should keep counting.
+		std::atomic_bool _counting{ false };
+		/// Number of the captured messages.
+		std::atomic<std::uint64_t> _messages{ 0 };
+		/// Number of the captured frames.
+		std::atomic<std::uint64_t> _frames{ 0 };
+		/// Number of the captured bytes.
+		std::atomic<std::uint64_t> _bytes{ 0 };
+
+	private: // status
+		/// Represents broker status.
+		enum class brokerStatus {
+			initialized,
+			running,
+			paused,
+			terminated,
+		};
+		/// broker::pause, broker::resume and broker::terminate could be
+		/// called from any thread.
+		std::atomic<brokerStatus> _status{ brokerStatus::initialized };
+
+	public: // constructors and destructors
+		/// @brief Registers the frontend and the backends.
+		/// @tparam frontend_t is ::Socket concept which the frontend
+		/// router binds to.
+		/// @tparam backend_t is ::Socket concept which the backend dealer
+		/// connects to.
+		/// @see concepts.h
+		/// @param frontend is the frontend endpoint.
+		/// @param backend is backend_t parameter pack.
+		template<Socket frontend_t, Socket... backend_t>
+		explicit
+		broker(frontend_t frontend, backend_t ... backend) noexcept
+				:_frontend{ std::make_shared<zmq::socket_t>(
+				_context, ZMQ_ROUTER) },
+				 _backend{ std::make_shared<zmq::socket_t>(
+						 _context, ZMQ_DEALER) } {
+			registerFrontend_(frontend);
+			(registerBackend_(backend), ...);
+		}
+
+		/// @brief Terminate the proxy.
+		~broker();
+
+	private:
+		/// @brief Binds the frontend to a tcp endpoint.
+		/// @warning This function could throw a runtime error if the specified
+		/// address (URI) of the tcp socket be invalid.
+		/// @see broker::validateURI_
+		void
+		registerFrontend_(const socketModel::tcp&);
+
+		/// @brief Binds the frontend to an ipc endpoint.
+		void
+		registerFrontend_(const socketModel::ipc&) noexcept;
+
+		/// @brief Binds the frontend to an inproc endpoint.
+		void
+		registerFrontend_(const socketModel::inproc&) noexcept;
+
+		/// @brief Connects the backend to a tcp endpoint.
+		/// @warning This function could throw a runtime error if the specified
+		/// address (URI) of the tcp socket be invalid.
+		/// @see broker::validateURI_
+		void
+		registerBackend_(const socketModel::tcp&);
+
+		/// @brief Connects the backend to an ipc endpoint.
+		void
+		registerBackend_(const socketModel::ipc&) noexcept;
+
+		/// @brief Connects the backend to an inproc endpoint.
+		void
+		registerBackend_(const socketModel::inproc&) noexcept;
+
+	private: // private methods
+		/// @brief Send a command to the proxy through the control socket.
+		void
+		steer_(const std::string&) noexcept;
+
+		/// @brief Count the captured messages until the counter is stopped.
+		void
+		count_() noexcept;
+
+		/// @brief Validate specified uri for the tcp protocol.
+		/// valid uri for the tcp protocol is <IPV4>:<PORT>
+		/// @return true if uri was valid and false otherwise.
+		[[nodiscard]]
+		bool
+		validateURI_(const std::string&) const noexcept;
+
+	public: // public methods
+		/// @brief Start forwarding on a background thread.
+		/// The broker stays initialized if its capture or control socket
+		/// could not be set up.
+		void
+		start() noexcept;
+
+		/// @brief Make the proxy stop forwarding.
+		/// Messages are queued by zmq meanwhile.
+		void
+		pause() noexcept;
+
+		/// @brief Make a paused proxy forward again.
+		void
+		resume() noexcept;
+
+		/// @brief Make the proxy return and stop counting.
+		void
+		terminate() noexcept;
+
+		/// @brief Specify the forwarded traffic so far.
+		/// @return The traffic counters.
+		[[nodiscard]]
+		traffic
+		statistics() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_BROKER_H
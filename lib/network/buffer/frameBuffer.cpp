@@ -0,0 +1,151 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:12
+//
+
+#include <algorithm>
+#include <cstring>
+#include <lib/network/buffer/frameBuffer.h>
+
+namespace agoNetwork {
+	frameBuffer::
+	frameBuffer(std::size_t capacity, std::size_t limit) noexcept
+			:_storage(std::min(capacity, limit)),
+			 _memory{ _storage },
+			 _limit{ limit } {}
+
+	frameBuffer::
+	frameBuffer(std::span<std::byte> memory) noexcept
+			:_memory{ memory },
+			 _limit{ memory.size() } {}
+
+	std::span<std::byte> frameBuffer::
+	append_(std::size_t size) noexcept {
+		if (size>_memory.size()-_used) {
+			// grow by doubling, the frames are offsets so they stay valid
+			const auto needed = _used+size;
+			if (not reserve(std::max(needed, std::min(_memory.size()*2, _limit)))) {
+				_truncated = true;
+				return {};
+			}
+		}
+		try {
+			_frames.emplace_back(_used, size);
+		}
+		catch (...) {
+			_truncated = true;
+			return {};
+		}
+		const auto frame = _memory.subspan(_used, size);
+		_used += size;
+		return frame;
+	}
+
+	bool frameBuffer::
+	append_(std::string_view bytes) noexcept {
+		const auto frame = append_(bytes.size());
+		if (_truncated) {
+			return false;
+		}
+		if (not bytes.empty()) {
+			std::memcpy(frame.data(), bytes.data(), bytes.size());
+		}
+		return true;
+	}
+
+	void frameBuffer::
+	pop_() noexcept {
+		if (not _frames.empty()) {
+			_used = _frames.back().first;
+			_frames.pop_back();
+		}
+	}
+
+	void frameBuffer::
+	drop_() noexcept {
+		_frames.clear();
+		_used = 0;
+	}
+
+	void frameBuffer::
+	swap_(std::size_t first, std::size_t second) noexcept {
+		std::swap(_frames[first], _frames[second]);
+	}
+
+	void frameBuffer::
+	clear() noexcept {
+		drop_();
+		_truncated = false;
+	}
+
+	bool frameBuffer::
+	reserve(std::size_t capacity) noexcept {
+		if (capacity<=_memory.size()) {
+			return true;
+		}
+		if (_storage.empty() && not _memory.empty()) {
+			// the memory is of the caller
+			return false;
+		}
+		if (capacity>_limit) {
+			return false;
+		}
+		try {
+			_storage.resize(capacity);
+		}
+		catch (...) {
+			return false;
+		}
+		_memory = _storage;
+		return true;
+	}
+
+	void frameBuffer::
+	shrink(std::size_t capacity) noexcept {
+		if (_storage.empty() || capacity>=_storage.size()) {
+			return;
+		}
+		clear();
+		_storage.resize(capacity);
+		_storage.shrink_to_fit();
+		_memory = _storage;
+	}
+
+	std::size_t frameBuffer::
+	capacity() const noexcept {
+		return _memory.size();
+	}
+
+	std::size_t frameBuffer::
+	used() const noexcept {
+		return _used;
+	}
+
+	bool frameBuffer::
+	truncated() const noexcept {
+		return _truncated;
+	}
+
+	std::size_t frameBuffer::
+	size() const noexcept {
+		return _frames.size();
+	}
+
+	bool frameBuffer::
+	empty() const noexcept {
+		return _frames.empty();
+	}
+
+	std::span<const std::byte> frameBuffer::
+	operator[](std::size_t frame) const noexcept {
+		const auto&[offset, size] = _frames[frame];
+		return std::span<const std::byte>{ _memory }.subspan(offset, size);
+	}
+
+	std::string_view frameBuffer::
+	view(std::size_t frame) const noexcept {
+		const auto bytes = (*this)[frame];
+		return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+	}
+}
@@ -0,0 +1,144 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:12
+//
+
+#ifndef AGO_NETWORK_FRAME_BUFFER_H
+#define AGO_NETWORK_FRAME_BUFFER_H
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace agoNetwork {
+	class socket;
+
+	/// @brief **frameBuffer** is reusable memory which a socket receives the
+	/// frames of a message into, see socket::receive.
+	/// The frames are laid out back to back and viewed as spans, so a
+	/// consumer which reuses the buffer processes messages in a fixed
+	/// memory footprint.
+	/// The buffer either owns its memory, which grows up to a limit, or
+	/// uses memory of the caller, which never grows. A message which does
+	/// not fit is dropped and the buffer is marked truncated.
+	class frameBuffer final {
+		friend class socket;
+
+	private: // private data
+		/// The owned memory, empty if the memory is of the caller.
+		std::vector<std::byte> _storage;
+		/// The memory which the frames are received into.
+		std::span<std::byte> _memory;
+		/// The owned memory never grows beyond the limit.
+		std::size_t _limit;
+		/// Offset and size of each frame.
+		std::vector<std::pair<std::size_t, std::size_t>> _frames;
+		/// Number of the bytes used by the frames.
+		std::size_t _used{ 0 };
+		/// Whether the last message did not fit.
+		bool _truncated{ false };
+
+	public: // constructors and destructors
+		/// @brief Own memory of the specified capacity which grows up to
+		/// the limit.
+		explicit
+		frameBuffer(
+				std::size_t capacity = 4096,
+				std::size_t limit = std::numeric_limits<std::size_t>::max())
+		noexcept;
+
+		/// @brief Use memory of the caller which never grows.
+		/// @note The memory should outlive the buffer.
+		explicit
+		frameBuffer(std::span<std::byte>) noexcept;
+
+		frameBuffer(const frameBuffer&) = delete;
+
+		frameBuffer&
+		operator=(const frameBuffer&) = delete;
+
+	private: // private methods
+		/// @brief Append a frame, growing the owned memory if needed.
+		/// @return The memory of the frame or an empty span with the buffer
+		/// marked truncated if the frame does not fit.
+		std::span<std::byte>
+		append_(std::size_t) noexcept;
+
+		/// @brief Append a frame of the specified bytes.
+		/// @return false if the frame does not fit.
+		bool
+		append_(std::string_view) noexcept;
+
+		/// @brief Drop the last frame.
+		void
+		pop_() noexcept;
+
+		/// @brief Drop all the frames of a dropped message, the buffer stays
+		/// marked truncated if the message did not fit.
+		void
+		drop_() noexcept;
+
+		/// @brief Swap the order of two frames.
+		void
+		swap_(std::size_t, std::size_t) noexcept;
+
+	public: // public methods
+		/// @brief Drop the frames and keep the memory.
+		void
+		clear() noexcept;
+
+		/// @brief Grow the owned memory to at least the specified capacity.
+		/// @return false if the memory is of the caller or the capacity is
+		/// beyond the limit.
+		bool
+		reserve(std::size_t) noexcept;
+
+		/// @brief Release the owned memory beyond the specified capacity,
+		/// e.g. once an unusually large message is processed.
+		/// The frames are dropped.
+		void
+		shrink(std::size_t) noexcept;
+
+		/// @brief Specify the number of the bytes which fit in the memory.
+		[[nodiscard]]
+		std::size_t
+		capacity() const noexcept;
+
+		/// @brief Specify the number of the bytes used by the frames.
+		[[nodiscard]]
+		std::size_t
+		used() const noexcept;
+
+		/// @brief Specify whether the last message was dropped since it
+		/// did not fit.
+		[[nodiscard]]
+		bool
+		truncated() const noexcept;
+
+		/// @brief Specify the number of the frames.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept;
+
+		/// @brief Specify whether there is no frame.
+		[[nodiscard]]
+		bool
+		empty() const noexcept;
+
+		/// @brief View a frame as bytes.
+		[[nodiscard]]
+		std::span<const std::byte>
+		operator[](std::size_t) const noexcept;
+
+		/// @brief View a frame as characters.
+		[[nodiscard]]
+		std::string_view
+		view(std::size_t) const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_FRAME_BUFFER_H
@@ -0,0 +1,80 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:27
+//
+
+#include <lib/network/cache/responseCache.h>
+
+namespace agoNetwork {
+	double responseCache::statistics::
+	hitRate() const noexcept {
+		const auto lookups = hits+misses;
+		return lookups==0 ? 0.0 : static_cast<double>(hits)/lookups;
+	}
+
+	responseCache::
+	responseCache(std::chrono::milliseconds ttl, std::size_t budget) noexcept
+			:_ttl{ ttl },
+			 _budget{ budget } { }
+
+	void responseCache::
+	erase_(std::list<entry>::iterator _entry) noexcept {
+		_bytes -= _entry->bytes;
+		_index.erase(_entry->key);
+		_entries.erase(_entry);
+	}
+
+	std::optional<std::vector<std::string>> responseCache::
+	lookup(const std::string& key) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto found = _index.find(key);
+		if (found==_index.end()) {
+			++_misses;
+			return std::nullopt;
+		}
+		const auto _entry = found->second;
+		if (_entry->expiry<=clock::now()) {
+			erase_(_entry);
+			++_misses;
+			return std::nullopt;
+		}
+		// move the entry to the front, it is the most recently used now
+		_entries.splice(_entries.begin(), _entries, _entry);
+		++_hits;
+		return _entry->replies;
+	}
+
+	void responseCache::
+	store(const std::string& key, std::vector<std::string> replies) noexcept {
+		std::size_t bytes{ key.size() };
+		for (const auto& reply : replies) {
+			bytes += reply.size();
+		}
+		if (bytes>_budget) {
+			return;
+		}
+		std::lock_guard lock{ _mutex };
+		if (const auto found = _index.find(key); found!=_index.end()) {
+			erase_(found->second);
+		}
+		while (_bytes+bytes>_budget && not _entries.empty()) {
+			erase_(std::prev(_entries.end()));
+			++_evictions;
+		}
+		_entries.push_front({ key, std::move(replies), clock::now()+_ttl, bytes });
+		_index[key] = _entries.begin();
+		_bytes += bytes;
+	}
+
+	responseCache::statistics responseCache::
+	stats() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return {
+				_hits.load(),
+				_misses.load(),
+				_evictions.load(),
+				_bytes
+		};
+	}
+}
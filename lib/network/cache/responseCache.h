@@ -0,0 +1,99 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:27
+//
+
+#ifndef AGO_NETWORK_RESPONSE_CACHE_H
+#define AGO_NETWORK_RESPONSE_CACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief **responseCache** keeps the replies of requests for a while,
+	/// so identical requests are replied without running the callbacks.
+	/// Entries expire after a time to live and the least recently used
+	/// entries are evicted once the byte budget is exceeded.
+	class responseCache final {
+	public: // public data
+		using clock = std::chrono::steady_clock;
+
+		/// @brief Cache counters.
+		struct statistics {
+			std::uint64_t hits{ 0 };
+			std::uint64_t misses{ 0 };
+			std::uint64_t evictions{ 0 };
+			/// Number of the bytes held by the entries.
+			std::size_t bytes{ 0 };
+
+			/// @brief Specify the ratio of the hits to the lookups.
+			[[nodiscard]]
+			double
+			hitRate() const noexcept;
+		};
+
+	private: // private data
+		/// @brief Replies of a request key.
+		struct entry {
+			std::string key;
+			std::vector<std::string> replies;
+			clock::time_point expiry;
+			std::size_t bytes;
+		};
+		/// Time to live of the entries.
+		std::chrono::milliseconds _ttl;
+		/// Maximum number of the bytes held by the entries.
+		std::size_t _budget;
+		/// Entries from the most to the least recently used.
+		std::list<entry> _entries;
+		/// Maps request key to its entry.
+		std::unordered_map<std::string, std::list<entry>::iterator> _index;
+		/// Number of the bytes held by the entries.
+		std::size_t _bytes{ 0 };
+		/// Guards the entries, lookups come from the listening thread while
+		/// replies are stored by the worker lanes.
+		mutable std::mutex _mutex;
+		std::atomic<std::uint64_t> _hits{ 0 };
+		std::atomic<std::uint64_t> _misses{ 0 };
+		std::atomic<std::uint64_t> _evictions{ 0 };
+
+	public: // constructors and destructors
+		/// @brief Initialize the cache.
+		/// @param ttl Time to live of the entries.
+		/// @param budget Maximum number of the bytes held by the entries.
+		explicit
+		responseCache(std::chrono::milliseconds ttl, std::size_t budget)
+		noexcept;
+
+	private: // private methods
+		/// @brief Remove an entry.
+		/// @note The mutex must be held.
+		void
+		erase_(std::list<entry>::iterator) noexcept;
+
+	public: // public methods
+		/// @brief Look the replies of a request key up.
+		/// @return The replies or nothing if the key is missing or expired.
+		std::optional<std::vector<std::string>>
+		lookup(const std::string&) noexcept;
+
+		/// @brief Keep the replies of a request key.
+		/// Entries bigger than the whole budget are not kept.
+		void
+		store(const std::string&, std::vector<std::string>) noexcept;
+
+		/// @brief Specify the cache counters.
+		[[nodiscard]]
+		statistics
+		stats() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_RESPONSE_CACHE_H
@@ -0,0 +1,86 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:40
+//
+
+#include <lib/network/coalescer/coalescer.h>
+
+namespace agoNetwork {
+	std::string coalescer::
+	key_(const std::string& name, const std::string& payload) noexcept {
+		std::string key;
+		key.reserve(name.size()+1+payload.size());
+		key.append(name).push_back('\0');
+		key.append(payload);
+		return key;
+	}
+
+	void coalescer::
+	enable(const std::string& name) noexcept {
+		std::unique_lock lock{ _socketsMutex };
+		_sockets.insert(name);
+	}
+
+	bool coalescer::
+	enabled(const std::string& name) const noexcept {
+		std::shared_lock lock{ _socketsMutex };
+		return _sockets.contains(name);
+	}
+
+	bool coalescer::
+	join(
+			const std::string& name,
+			const std::string& payload,
+			const std::string& identity,
+			const std::string& header) noexcept {
+		std::lock_guard lock{ _mutex };
+		auto[flight, leads] = _flights.try_emplace(key_(name, payload));
+		if (not leads) {
+			flight->second.push_back({ identity, header });
+			++_coalesced;
+		}
+		return leads;
+	}
+
+	std::vector<coalescer::waiter> coalescer::
+	land(const std::string& name, const std::string& payload) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto flight = _flights.find(key_(name, payload));
+		if (flight==_flights.end()) {
+			return {};
+		}
+		auto waiters = std::move(flight->second);
+		_flights.erase(flight);
+		return waiters;
+	}
+
+	std::shared_ptr<void> coalescer::
+	flight(
+			const std::string& name,
+			const std::string& payload,
+			std::shared_ptr<const std::vector<std::string>> replies,
+			std::shared_ptr<const bool> ran,
+			std::string fallback,
+			sender send) noexcept {
+		return std::shared_ptr<void>{
+				nullptr,
+				[this, name, payload, replies = std::move(replies), ran = std::move(ran),
+						fallback = std::move(fallback), send = std::move(send)](void*) {
+					for (const auto& waiter : land(name, payload)) {
+						if (not ran || not *ran || not replies) {
+							send(waiter, fallback);
+							continue;
+						}
+						for (const auto& reply : *replies) {
+							send(waiter, reply);
+						}
+					}
+				}};
+	}
+
+	std::uint64_t coalescer::
+	coalesced() const noexcept {
+		return _coalesced;
+	}
+}
@@ -0,0 +1,115 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:40
+//
+
+#ifndef AGO_NETWORK_COALESCER_H
+#define AGO_NETWORK_COALESCER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief **coalescer** keeps track of the identical requests in flight.
+	/// The first request of a payload leads a flight and runs the callbacks,
+	/// identical requests which arrive meanwhile join the flight and receive
+	/// the reply of the leader once it lands.
+	class coalescer final {
+	public: // public data
+		/// @brief A request which joined a flight.
+		struct waiter {
+			/// The client address.
+			std::string identity;
+			/// The header of the replies, e.g. the echoed request id.
+			std::string header;
+		};
+		/// sender is a function alias which sends a reply to a waiter.
+		using sender = std::function<void(const waiter&, const std::string&)>;
+
+	private: // private data
+		/// Names of the sockets which coalesce their requests.
+		std::unordered_set<std::string> _sockets;
+		/// Guards coalescer::_sockets, they are read for every request and
+		/// could be enabled while listening.
+		mutable std::shared_mutex _socketsMutex;
+		/// Guards coalescer::_flights.
+		std::mutex _mutex;
+		/// Maps socket name and payload to the requests waiting for
+		/// the reply of the leader.
+		std::unordered_map<std::string, std::vector<waiter>> _flights;
+		/// Number of the requests which joined a flight.
+		std::atomic<std::uint64_t> _coalesced{ 0 };
+
+	private: // private methods
+		/// @brief Make the key of a flight.
+		/// The whole payload is used instead of its hash alone, so a hash
+		/// collision could never send a wrong reply.
+		[[nodiscard]]
+		static std::string
+		key_(const std::string&, const std::string&) noexcept;
+
+	public: // public methods
+		/// @brief Make the specified socket coalesce its requests.
+		/// @note It could be called while listening.
+		void
+		enable(const std::string&) noexcept;
+
+		/// @brief Specify whether the socket coalesces its requests.
+		[[nodiscard]]
+		bool
+		enabled(const std::string&) const noexcept;
+
+		/// @brief Join the flight of a payload or lead a new one.
+		/// @param name Name of the socket.
+		/// @param payload The request message.
+		/// @param identity The client address.
+		/// @param header The header of the replies to the request.
+		/// @return true if the request leads the flight and false if it
+		/// joined an existing flight.
+		bool
+		join(const std::string& name, const std::string& payload,
+				const std::string& identity,
+				const std::string& header = {}) noexcept;
+
+		/// @brief Finish the flight of a payload.
+		/// @return The requests which joined the flight.
+		std::vector<waiter>
+		land(const std::string& name, const std::string& payload) noexcept;
+
+		/// @brief Make the handle of the flight which a request leads.
+		/// The flight lands once the last copy of the handle is destroyed,
+		/// whether the leader is handled, expired or dropped: its waiters
+		/// receive the replies of the leader if it ran and the fallback
+		/// otherwise, so none of them is left without a reply.
+		/// @param name Name of the socket.
+		/// @param payload The request message.
+		/// @param replies The replies which the callbacks of the leader send.
+		/// @param ran Whether the callbacks of the leader ran.
+		/// @param fallback The reply of the waiters of a leader which never
+		/// ran, e.g. the busy reply.
+		/// @param send Sends a reply to a waiter.
+		[[nodiscard]]
+		std::shared_ptr<void>
+		flight(const std::string& name, const std::string& payload,
+				std::shared_ptr<const std::vector<std::string>> replies,
+				std::shared_ptr<const bool> ran,
+				std::string fallback,
+				sender send) noexcept;
+
+		/// @brief Specify the number of the requests which joined a flight
+		/// and never ran the callbacks.
+		[[nodiscard]]
+		std::uint64_t
+		coalesced() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_COALESCER_H
@@ -0,0 +1,62 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 23:30
+//
+
+#ifndef AGO_NETWORK_CODEC_H
+#define AGO_NETWORK_CODEC_H
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <lib/concepts/concepts.h>
+#include <lib/network/codec/varintCodec.h>
+
+namespace agoNetwork {
+	/// @brief **fixedCodec** is the reference ::messageCodec which maps a
+	/// trivially copyable message to its bytes as laid out in memory.
+	/// Decoding is a single copy out of the received frame and encoding a
+	/// single copy into the send buffer, nothing is parsed or allocated.
+	/// @warning Both sides should share the layout (the same struct,
+	/// compiler and byte order), see agoNetwork::varintCodec otherwise.
+	template<typename message_t>
+	requires std::is_trivially_copyable_v<message_t>
+			&& std::is_standard_layout_v<message_t>
+	struct fixedCodec {
+		/// @return The message or nothing if the frame size does not match.
+		static std::optional<message_t>
+		decode(std::string_view frame) noexcept {
+			if (frame.size()!=sizeof(message_t)) {
+				return std::nullopt;
+			}
+			message_t message;
+			std::memcpy(&message, frame.data(), sizeof(message_t));
+			return message;
+		}
+
+		static void
+		encode(const message_t& message, std::string& buffer) noexcept {
+			buffer.assign(
+					reinterpret_cast<const char*>(&message),
+					sizeof(message_t));
+		}
+	};
+
+	/// @brief Encode a message into the send buffer of the calling thread.
+	/// The buffer keeps its capacity between the calls, so replies and
+	/// requests are encoded without allocating.
+	/// @return The buffer, valid until the next call on the same thread.
+	template<typename message_t, typename codec_t = fixedCodec<message_t>>
+	requires messageCodec<codec_t, message_t>
+	const std::string&
+	encoded(const message_t& message) noexcept {
+		thread_local std::string buffer;
+		codec_t::encode(message, buffer);
+		return buffer;
+	}
+}
+
+#endif //AGO_NETWORK_CODEC_H
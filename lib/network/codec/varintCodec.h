@@ -0,0 +1,217 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 23:30
+//
+
+#ifndef AGO_NETWORK_VARINT_CODEC_H
+#define AGO_NETWORK_VARINT_CODEC_H
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace agoNetwork {
+	namespace varint {
+		/// @brief Append a base 128 varint.
+		inline void
+		put(std::string& buffer, std::uint64_t value) noexcept {
+			while (value>=0x80) {
+				buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+			buffer.push_back(static_cast<char>(value));
+		}
+
+		/// @brief Read a base 128 varint.
+		/// @return The value or nothing if it is truncated or longer than
+		/// 64 bits.
+		inline std::optional<std::uint64_t>
+		get(std::string_view frame, std::size_t& offset) noexcept {
+			std::uint64_t value{ 0 };
+			for (unsigned int shift{ 0 }; offset<frame.size() && shift<64; shift += 7) {
+				const auto byte = static_cast<unsigned char>(frame[offset++]);
+				if (shift==63 && byte>1) {
+					return std::nullopt;
+				}
+				value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				if (not (byte & 0x80)) {
+					return value;
+				}
+			}
+			return std::nullopt;
+		}
+
+		/// @brief A field which the codec could encode.
+		template<typename field_t>
+		concept field = std::is_integral_v<field_t>
+				|| std::is_enum_v<field_t>
+				|| std::is_floating_point_v<field_t>
+				|| std::is_same_v<field_t, std::string>
+				|| std::is_same_v<field_t, std::string_view>;
+
+		/// @brief The type of the member which a member pointer points to.
+		template<typename pointer_t>
+		struct member;
+
+		template<typename class_t, typename field_t>
+		struct member<field_t class_t::*> {
+			using type = field_t;
+		};
+
+		template<typename field_t>
+		void
+		encode(const field_t& value, std::string& buffer) noexcept {
+			if constexpr (std::is_enum_v<field_t>) {
+				encode(static_cast<std::underlying_type_t<field_t>>(value), buffer);
+			}
+			else if constexpr (std::is_same_v<field_t, bool>) {
+				put(buffer, value ? 1 : 0);
+			}
+			else if constexpr (std::is_integral_v<field_t> && std::is_signed_v<field_t>) {
+				// zigzag, so small negative values stay short
+				const auto wide = static_cast<std::int64_t>(value);
+				put(buffer, (static_cast<std::uint64_t>(wide) << 1)
+						^ static_cast<std::uint64_t>(wide >> 63));
+			}
+			else if constexpr (std::is_integral_v<field_t>) {
+				put(buffer, value);
+			}
+			else if constexpr (std::is_floating_point_v<field_t>) {
+				// little endian, whatever the byte order of the host is
+				using bits_t = std::conditional_t<sizeof(field_t)==4, std::uint32_t, std::uint64_t>;
+				static_assert(sizeof(field_t)==sizeof(bits_t));
+				bits_t bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				for (std::size_t byte{ 0 }; byte<sizeof(bits); ++byte) {
+					buffer.push_back(static_cast<char>(bits >> (8*byte)));
+				}
+			}
+			else {
+				put(buffer, value.size());
+				buffer.append(value);
+			}
+		}
+
+		/// @return true if the field is decoded and false if the frame is
+		/// truncated or the value does not fit the field.
+		template<typename field_t>
+		bool
+		decode(std::string_view frame, std::size_t& offset, field_t& value) noexcept {
+			if constexpr (std::is_enum_v<field_t>) {
+				std::underlying_type_t<field_t> underlying;
+				if (not decode(frame, offset, underlying)) {
+					return false;
+				}
+				value = static_cast<field_t>(underlying);
+				return true;
+			}
+			else if constexpr (std::is_same_v<field_t, bool>) {
+				const auto raw = get(frame, offset);
+				if (not raw || *raw>1) {
+					return false;
+				}
+				value = *raw==1;
+				return true;
+			}
+			else if constexpr (std::is_integral_v<field_t> && std::is_signed_v<field_t>) {
+				const auto raw = get(frame, offset);
+				if (not raw) {
+					return false;
+				}
+				const auto wide = static_cast<std::int64_t>(*raw >> 1)
+						^ -static_cast<std::int64_t>(*raw & 1);
+				if (wide<std::numeric_limits<field_t>::min()
+						|| wide>std::numeric_limits<field_t>::max()) {
+					return false;
+				}
+				value = static_cast<field_t>(wide);
+				return true;
+			}
+			else if constexpr (std::is_integral_v<field_t>) {
+				const auto raw = get(frame, offset);
+				if (not raw || *raw>std::numeric_limits<field_t>::max()) {
+					return false;
+				}
+				value = static_cast<field_t>(*raw);
+				return true;
+			}
+			else if constexpr (std::is_floating_point_v<field_t>) {
+				using bits_t = std::conditional_t<sizeof(field_t)==4, std::uint32_t, std::uint64_t>;
+				if (frame.size()-offset<sizeof(bits_t)) {
+					return false;
+				}
+				bits_t bits{ 0 };
+				for (std::size_t byte{ 0 }; byte<sizeof(bits); ++byte) {
+					bits |= static_cast<bits_t>(static_cast<unsigned char>(frame[offset+byte])) << (8*byte);
+				}
+				offset += sizeof(bits);
+				std::memcpy(&value, &bits, sizeof(bits));
+				return true;
+			}
+			else {
+				const auto size = get(frame, offset);
+				if (not size || *size>frame.size()-offset) {
+					return false;
+				}
+				value = field_t{ frame.substr(offset, *size) };
+				offset += *size;
+				return true;
+			}
+		}
+	}
+
+	/// @brief A message which lists its fields, in their wire order, as
+	/// member pointers, e.g.
+	/// static constexpr auto fields = std::make_tuple(&order::id, &order::price);
+	template<typename message_t>
+	concept varintSchema = std::is_default_constructible_v<message_t>
+			&& requires { std::tuple_size<std::remove_cv_t<decltype(message_t::fields)>>::value; }
+			&& []<std::size_t... index>(std::index_sequence<index...>) {
+				return (varint::field<typename varint::member<std::remove_cv_t<
+						std::tuple_element_t<index, std::remove_cv_t<decltype(message_t::fields)>>>>::type> && ...);
+			}(std::make_index_sequence<std::tuple_size_v<std::remove_cv_t<decltype(message_t::fields)>>>{});
+
+	/// @brief **varintCodec** is the ::messageCodec of messages which list
+	/// their fields (see ::varintSchema). Unlike agoNetwork::fixedCodec the
+	/// frame does not depend on the layout, the compiler or the byte order.
+	/// Integers are varints (signed ones zigzag encoded), floating point
+	/// numbers are little endian and strings are prefixed by their size.
+	/// Fields carry no tags, so the schema evolves by appending fields: a
+	/// frame which ends early leaves the remaining fields defaulted and the
+	/// bytes of unknown trailing fields are ignored.
+	/// @note std::string_view fields point into the decoded frame, so they
+	/// are valid only as long as the frame (e.g. within a typed callback).
+	template<varintSchema message_t>
+	struct varintCodec {
+		/// @return The message or nothing if a field is truncated or does
+		/// not fit its type.
+		static std::optional<message_t>
+		decode(std::string_view frame) noexcept {
+			message_t message{};
+			std::size_t offset{ 0 };
+			const auto decoded = std::apply([&](const auto... field) {
+				return ((offset==frame.size() || varint::decode(frame, offset, message.*field)) && ...);
+			}, message_t::fields);
+			if (not decoded) {
+				return std::nullopt;
+			}
+			return message;
+		}
+
+		static void
+		encode(const message_t& message, std::string& buffer) noexcept {
+			buffer.clear();
+			std::apply([&](const auto... field) {
+				(varint::encode(message.*field, buffer), ...);
+			}, message_t::fields);
+		}
+	};
+}
+
+#endif //AGO_NETWORK_VARINT_CODEC_H
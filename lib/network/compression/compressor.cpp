@@ -0,0 +1,416 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 22:40
+//
+
+#include <cstring>
+#include <vector>
+#include <lib/network/compression/compressor.h>
+#ifdef AGO_NETWORK_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef AGO_NETWORK_WITH_LZ4
+#include <lz4.h>
+#endif
+
+namespace agoNetwork {
+	namespace {
+		/// The flag bit of the messages compressed with the dictionary.
+		constexpr std::uint8_t dictionaryFlag{ 0x80 };
+		/// A byte of the LZ77 and lz4 formats never stands for more than
+		/// this many bytes of the message, so a larger claimed size is a lie.
+		constexpr std::size_t maxExpansion{ 256 };
+
+		/// @brief Append a base 128 varint.
+		void
+		putSize(std::string& out, std::size_t size) noexcept {
+			while (size>=0x80) {
+				out.push_back(static_cast<char>((size & 0x7F) | 0x80));
+				size >>= 7;
+			}
+			out.push_back(static_cast<char>(size));
+		}
+
+		/// @brief Read a base 128 varint.
+		std::optional<std::size_t>
+		getSize(std::string_view in, std::size_t& offset) noexcept {
+			std::size_t size{ 0 };
+			for (unsigned int shift{ 0 }; offset<in.size() && shift<64; shift += 7) {
+				const auto byte = static_cast<unsigned char>(in[offset++]);
+				size |= static_cast<std::size_t>(byte & 0x7F) << shift;
+				if (not (byte & 0x80)) {
+					return size;
+				}
+			}
+			return std::nullopt;
+		}
+
+		/// The built-in codec is LZ77 with a layout close to lz4 blocks:
+		/// the original size as a varint, then sequences of a token (literal
+		/// length and match length nibbles), the literals, a two bytes offset
+		/// and the match. The last sequence has literals only.
+		namespace lz {
+			constexpr std::size_t minMatch{ 4 };
+			constexpr std::size_t maxOffset{ 0xFFFF };
+			constexpr unsigned int hashBits{ 14 };
+
+			std::uint32_t
+			read32(const char* data) noexcept {
+				std::uint32_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return value;
+			}
+
+			std::size_t
+			hash(std::uint32_t value) noexcept {
+				return (value*2654435761u) >> (32-hashBits);
+			}
+
+			/// @brief Append a length beyond its nibble.
+			void
+			putLength(std::string& out, std::size_t length) noexcept {
+				while (length>=255) {
+					out.push_back(static_cast<char>(255));
+					length -= 255;
+				}
+				out.push_back(static_cast<char>(length));
+			}
+
+			/// @brief Read a length beyond its nibble.
+			std::optional<std::size_t>
+			getLength(std::string_view in, std::size_t& offset) noexcept {
+				std::size_t length{ 0 };
+				while (offset<in.size()) {
+					const auto byte = static_cast<unsigned char>(in[offset++]);
+					length += byte;
+					if (byte!=255) {
+						return length;
+					}
+				}
+				return std::nullopt;
+			}
+
+			/// @brief Append a sequence, no match means the last sequence.
+			void
+			putSequence(
+					std::string& out,
+					std::string_view literals,
+					std::size_t offset,
+					std::size_t match) noexcept {
+				const auto matchCode = match==0 ? 0 : match-minMatch;
+				out.push_back(static_cast<char>(
+						(std::min<std::size_t>(literals.size(), 15) << 4)
+								| std::min<std::size_t>(matchCode, 15)));
+				if (literals.size()>=15) {
+					putLength(out, literals.size()-15);
+				}
+				out.append(literals);
+				if (match==0) {
+					return;
+				}
+				out.push_back(static_cast<char>(offset & 0xFF));
+				out.push_back(static_cast<char>(offset >> 8));
+				if (matchCode>=15) {
+					putLength(out, matchCode-15);
+				}
+			}
+
+			std::string
+			compress(std::string_view input, std::string_view dictionary) noexcept {
+				// the dictionary is history which the matches could refer to
+				std::string window;
+				window.reserve(dictionary.size()+input.size());
+				window.append(dictionary).append(input);
+				const auto* data = window.data();
+				const auto start = dictionary.size();
+				const auto end = window.size();
+				std::vector<std::int64_t> table(std::size_t{ 1 } << hashBits, -1);
+				for (std::size_t position{ 0 }; position+minMatch<=start; ++position) {
+					table[hash(read32(data+position))] = static_cast<std::int64_t>(position);
+				}
+				std::string out;
+				out.reserve(input.size()/2+16);
+				putSize(out, input.size());
+				auto anchor = start;
+				auto position = start;
+				while (position+minMatch<=end) {
+					const auto slot = hash(read32(data+position));
+					const auto candidate = table[slot];
+					table[slot] = static_cast<std::int64_t>(position);
+					if (candidate<0
+							|| position-static_cast<std::size_t>(candidate)>maxOffset
+							|| read32(data+candidate)!=read32(data+position)) {
+						++position;
+						continue;
+					}
+					auto match = minMatch;
+					while (position+match<end && data[candidate+match]==data[position+match]) {
+						++match;
+					}
+					putSequence(out,
+							std::string_view{ data+anchor, position-anchor },
+							position-static_cast<std::size_t>(candidate),
+							match);
+					position += match;
+					anchor = position;
+				}
+				putSequence(out, std::string_view{ data+anchor, end-anchor }, 0, 0);
+				return out;
+			}
+
+			std::optional<std::string>
+			decompress(
+					std::string_view in,
+					std::string_view dictionary,
+					std::size_t maxSize) noexcept {
+				std::size_t offset{ 0 };
+				const auto size = getSize(in, offset);
+				if (not size || *size>maxSize || *size>in.size()*maxExpansion) {
+					return std::nullopt;
+				}
+				std::string out;
+				out.reserve(dictionary.size()+*size);
+				out.append(dictionary);
+				while (offset<in.size()) {
+					const auto token = static_cast<unsigned char>(in[offset++]);
+					std::size_t literals = token >> 4;
+					if (literals==15) {
+						const auto more = getLength(in, offset);
+						if (not more) {
+							return std::nullopt;
+						}
+						literals += *more;
+					}
+					if (literals>in.size()-offset) {
+						return std::nullopt;
+					}
+					out.append(in.substr(offset, literals));
+					offset += literals;
+					if (offset==in.size()) {
+						break;
+					}
+					if (offset+2>in.size()) {
+						return std::nullopt;
+					}
+					const auto distance =
+							static_cast<std::size_t>(static_cast<unsigned char>(in[offset]))
+									| static_cast<std::size_t>(static_cast<unsigned char>(in[offset+1])) << 8;
+					offset += 2;
+					std::size_t match = (token & 0x0F)+minMatch;
+					if ((token & 0x0F)==15) {
+						const auto more = getLength(in, offset);
+						if (not more) {
+							return std::nullopt;
+						}
+						match += *more;
+					}
+					if (distance==0 || distance>out.size()
+							|| out.size()+match>dictionary.size()+*size) {
+						return std::nullopt;
+					}
+					// the match could overlap itself, so copy byte by byte
+					auto from = out.size()-distance;
+					for (std::size_t byte{ 0 }; byte<match; ++byte) {
+						out.push_back(out[from++]);
+					}
+				}
+				if (out.size()!=dictionary.size()+*size) {
+					return std::nullopt;
+				}
+				return out.substr(dictionary.size());
+			}
+		}
+	}
+
+	double compressor::statistics::
+	ratio() const noexcept {
+		return bytesOut==0
+				? 1.0
+				: static_cast<double>(bytesIn)/static_cast<double>(bytesOut);
+	}
+
+	compressor::
+	compressor(compressionOptions _options) noexcept
+			:_options{ std::move(_options) } {
+		if (not available(this->_options.algorithm)) {
+			this->_options.algorithm = compression::lz;
+		}
+	}
+
+	bool compressor::
+	available(compression algorithm) noexcept {
+		switch (algorithm) {
+		case compression::none:
+		case compression::lz: {
+			return true;
+		}
+		case compression::zstd: {
+#ifdef AGO_NETWORK_WITH_ZSTD
+			return true;
+#else
+			return false;
+#endif
+		}
+		case compression::lz4: {
+#ifdef AGO_NETWORK_WITH_LZ4
+			return true;
+#else
+			return false;
+#endif
+		}
+		}
+		return false;
+	}
+
+	std::optional<std::pair<std::uint8_t, std::string>> compressor::
+	compress(std::string_view message) noexcept {
+		if (_options.algorithm==compression::none
+				|| message.size()<_options.threshold) {
+			std::lock_guard lock{ _mutex };
+			++_statistics.skipped;
+			return std::nullopt;
+		}
+		const auto begin = std::chrono::steady_clock::now();
+		const std::string_view dictionary{ _options.dictionary };
+		std::string out;
+		switch (_options.algorithm) {
+		case compression::zstd: {
+#ifdef AGO_NETWORK_WITH_ZSTD
+			out.resize(ZSTD_compressBound(message.size()));
+			auto context = ZSTD_createCCtx();
+			const auto size = dictionary.empty()
+					? ZSTD_compressCCtx(context, out.data(), out.size(),
+							message.data(), message.size(), _options.level)
+					: ZSTD_compress_usingDict(context, out.data(), out.size(),
+							message.data(), message.size(),
+							dictionary.data(), dictionary.size(), _options.level);
+			ZSTD_freeCCtx(context);
+			if (ZSTD_isError(size)) {
+				out.clear();
+			}
+			else {
+				out.resize(size);
+			}
+#endif
+			break;
+		}
+		case compression::lz4: {
+#ifdef AGO_NETWORK_WITH_LZ4
+			putSize(out, message.size());
+			const auto header = out.size();
+			out.resize(header+LZ4_compressBound(static_cast<int>(message.size())));
+			auto stream = LZ4_createStream();
+			if (not dictionary.empty()) {
+				LZ4_loadDict(stream, dictionary.data(), static_cast<int>(dictionary.size()));
+			}
+			const auto size = LZ4_compress_fast_continue(stream,
+					message.data(), out.data()+header,
+					static_cast<int>(message.size()),
+					static_cast<int>(out.size()-header), 1);
+			LZ4_freeStream(stream);
+			if (size<=0) {
+				out.clear();
+			}
+			else {
+				out.resize(header+static_cast<std::size_t>(size));
+			}
+#endif
+			break;
+		}
+		default: {
+			out = lz::compress(message, dictionary);
+			break;
+		}
+		}
+		const auto elapsed = std::chrono::steady_clock::now()-begin;
+		std::lock_guard lock{ _mutex };
+		if (out.empty() || out.size()>=message.size()) {
+			++_statistics.skipped;
+			return std::nullopt;
+		}
+		++_statistics.compressed;
+		_statistics.bytesIn += message.size();
+		_statistics.bytesOut += out.size();
+		_statistics.compressTime += elapsed;
+		auto flag = static_cast<std::uint8_t>(_options.algorithm);
+		if (not dictionary.empty()) {
+			flag |= dictionaryFlag;
+		}
+		return std::pair{ flag, std::move(out) };
+	}
+
+	std::optional<std::string> compressor::
+	decompress(std::uint8_t flag, std::string_view message) noexcept {
+		const auto begin = std::chrono::steady_clock::now();
+		std::string_view dictionary;
+		if (flag & dictionaryFlag) {
+			dictionary = _options.dictionary;
+		}
+		std::optional<std::string> out;
+		switch (static_cast<compression>(flag & ~dictionaryFlag)) {
+		case compression::lz: {
+			out = lz::decompress(message, dictionary, _options.maxSize);
+			break;
+		}
+		case compression::zstd: {
+#ifdef AGO_NETWORK_WITH_ZSTD
+			const auto size = ZSTD_getFrameContentSize(message.data(), message.size());
+			if (size==ZSTD_CONTENTSIZE_ERROR || size==ZSTD_CONTENTSIZE_UNKNOWN
+					|| size>_options.maxSize) {
+				break;
+			}
+			std::string plain(size, '\0');
+			auto context = ZSTD_createDCtx();
+			const auto written = ZSTD_decompress_usingDict(context,
+					plain.data(), plain.size(),
+					message.data(), message.size(),
+					dictionary.data(), dictionary.size());
+			ZSTD_freeDCtx(context);
+			if (not ZSTD_isError(written) && written==size) {
+				out = std::move(plain);
+			}
+#endif
+			break;
+		}
+		case compression::lz4: {
+#ifdef AGO_NETWORK_WITH_LZ4
+			std::size_t offset{ 0 };
+			const auto size = getSize(message, offset);
+			if (not size || *size>_options.maxSize
+					|| *size>(message.size()-offset)*maxExpansion) {
+				break;
+			}
+			std::string plain(*size, '\0');
+			const auto written = LZ4_decompress_safe_usingDict(
+					message.data()+offset, plain.data(),
+					static_cast<int>(message.size()-offset),
+					static_cast<int>(plain.size()),
+					dictionary.data(), static_cast<int>(dictionary.size()));
+			if (written>=0 && static_cast<std::size_t>(written)==*size) {
+				out = std::move(plain);
+			}
+#endif
+			break;
+		}
+		default: {
+			break;
+		}
+		}
+		const auto elapsed = std::chrono::steady_clock::now()-begin;
+		std::lock_guard lock{ _mutex };
+		if (not out) {
+			++_statistics.failed;
+			return std::nullopt;
+		}
+		++_statistics.decompressed;
+		_statistics.decompressTime += elapsed;
+		return out;
+	}
+
+	compressor::statistics compressor::
+	stats() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return _statistics;
+	}
+}
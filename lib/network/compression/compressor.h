@@ -0,0 +1,108 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 22:40
+//
+
+#ifndef AGO_NETWORK_COMPRESSOR_H
+#define AGO_NETWORK_COMPRESSOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace agoNetwork {
+	/// @brief Represents compression algorithms.
+	enum class compression : std::uint8_t {
+		none = 0,
+		/// The built-in LZ77 codec, always available.
+		lz = 1,
+		/// Available if the library is built with zstd.
+		zstd = 2,
+		/// Available if the library is built with lz4.
+		lz4 = 3,
+	};
+
+	/// @brief Compression options of a socket.
+	struct compressionOptions {
+		compression algorithm{ compression::lz };
+		/// Messages shorter than this are sent as they are.
+		std::size_t threshold{ 256 };
+		/// Content which small messages have in common (e.g. field names),
+		/// both sides should use the same dictionary.
+		std::string dictionary;
+		/// Compression level of zstd.
+		int level{ 1 };
+		/// Messages which claim to be larger once decompressed are dropped,
+		/// otherwise a peer could make the socket allocate any size it
+		/// claims.
+		std::size_t maxSize{ std::size_t{ 16 } << 20 };
+	};
+
+	/// @brief **compressor** compresses the messages of a socket and
+	/// reports how well and how fast it does.
+	/// A compressed message is flagged by one byte (the algorithm and
+	/// whether the dictionary is used), so compressed and plain messages
+	/// could be mixed on the same connection.
+	class compressor final {
+	public: // public data
+		/// @brief What the compressor did so far.
+		struct statistics {
+			std::uint64_t compressed{ 0 };
+			/// Number of the messages sent as they are since they are too
+			/// short or do not shrink.
+			std::uint64_t skipped{ 0 };
+			std::uint64_t decompressed{ 0 };
+			/// Number of the messages which could not be decompressed.
+			std::uint64_t failed{ 0 };
+			/// Bytes of the compressed messages before and after.
+			std::uint64_t bytesIn{ 0 };
+			std::uint64_t bytesOut{ 0 };
+			std::chrono::nanoseconds compressTime{ 0 };
+			std::chrono::nanoseconds decompressTime{ 0 };
+
+			/// @brief Specify how many times smaller the compressed
+			/// messages are, one if nothing is compressed.
+			[[nodiscard]]
+			double
+			ratio() const noexcept;
+		};
+
+	private: // private data
+		compressionOptions _options;
+		statistics _statistics;
+		mutable std::mutex _mutex;
+
+	public: // constructors and destructors
+		explicit
+		compressor(compressionOptions _options = {}) noexcept;
+
+	public: // public methods
+		/// @brief Compress a message.
+		/// @return The flag and the compressed message or nothing if the
+		/// message should be sent as it is.
+		std::optional<std::pair<std::uint8_t, std::string>>
+		compress(std::string_view) noexcept;
+
+		/// @brief Decompress a message by its flag.
+		/// @return The message or nothing if it could not be decompressed.
+		std::optional<std::string>
+		decompress(std::uint8_t, std::string_view) noexcept;
+
+		/// @brief Specify whether an algorithm is built in.
+		[[nodiscard]]
+		static bool
+		available(compression) noexcept;
+
+		/// @brief Specify what the compressor did so far.
+		[[nodiscard]]
+		statistics
+		stats() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_COMPRESSOR_H
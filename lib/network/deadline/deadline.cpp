@@ -0,0 +1,54 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:21
+//
+
+#include <lib/network/deadline/deadline.h>
+
+namespace agoNetwork {
+	namespace {
+		/// The current deadline of each thread.
+		thread_local std::optional<deadline::clock::time_point> currentDeadline;
+	}
+
+	deadline::
+	deadline(std::optional<clock::time_point> timePoint) noexcept
+			:_previous{ currentDeadline } {
+		if (timePoint && (not currentDeadline || *timePoint<*currentDeadline)) {
+			currentDeadline = timePoint;
+		}
+	}
+
+	deadline::
+	deadline(std::chrono::milliseconds budget) noexcept
+			:deadline{ std::optional{ clock::now()+budget }} { }
+
+	deadline::
+	~deadline() {
+		currentDeadline = _previous;
+	}
+
+	std::optional<deadline::clock::time_point> deadline::
+	current() noexcept {
+		return currentDeadline;
+	}
+
+	std::optional<std::chrono::milliseconds> deadline::
+	remaining() noexcept {
+		if (not currentDeadline) {
+			return std::nullopt;
+		}
+		const auto now = clock::now();
+		if (*currentDeadline<=now) {
+			return std::chrono::milliseconds{ 0 };
+		}
+		return std::chrono::ceil<std::chrono::milliseconds>(
+				*currentDeadline-now);
+	}
+
+	bool deadline::
+	expired() noexcept {
+		return currentDeadline && *currentDeadline<=clock::now();
+	}
+}
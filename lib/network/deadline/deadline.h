@@ -0,0 +1,69 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:21
+//
+
+#ifndef AGO_NETWORK_DEADLINE_H
+#define AGO_NETWORK_DEADLINE_H
+
+#include <chrono>
+#include <optional>
+
+namespace agoNetwork {
+	/// @brief **deadline** holds the deadline of the request which is
+	/// handled by the calling thread.
+	/// The router sets it around the callbacks and the dealer attaches
+	/// the remaining budget to the requests sent meanwhile, so deadlines
+	/// propagate to the downstream calls.
+	class deadline final {
+	public: // public data
+		using clock = std::chrono::steady_clock;
+
+	private: // private data
+		/// The deadline which was current before this one.
+		std::optional<clock::time_point> _previous;
+
+	public: // constructors and destructors
+		/// @brief Make the specified deadline current for the calling thread
+		/// until the object goes out of scope.
+		/// A later deadline never extends the current one.
+		explicit
+		deadline(std::optional<clock::time_point>) noexcept;
+
+		/// @brief Make the deadline current for the calling thread
+		/// which expires after the specified budget.
+		explicit
+		deadline(std::chrono::milliseconds) noexcept;
+
+		deadline(const deadline&) = delete;
+
+		deadline&
+		operator=(const deadline&) = delete;
+
+		/// @brief Restore the previous deadline.
+		~deadline();
+
+	public: // public methods
+		/// @brief Specify the current deadline of the calling thread.
+		/// @return The deadline or nothing if there is no deadline.
+		[[nodiscard]]
+		static std::optional<clock::time_point>
+		current() noexcept;
+
+		/// @brief Specify the remaining budget of the current deadline.
+		/// @return The remaining budget (zero once expired) or nothing if
+		/// there is no deadline.
+		[[nodiscard]]
+		static std::optional<std::chrono::milliseconds>
+		remaining() noexcept;
+
+		/// @brief Specify whether the current deadline is passed.
+		/// @return true if the deadline is passed and false otherwise.
+		[[nodiscard]]
+		static bool
+		expired() noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_DEADLINE_H
@@ -5,8 +5,15 @@
 // Last edit on 3/31/20 15:20
 //
 
+#include <algorithm>
 #include <regex>
+#include <limits>
+#include <iterator>
+#include <utility>
 #include <lib/network/dealer/dealer.h>
+#include <lib/network/deadline/deadline.h>
+#include <lib/network/envelope/envelope.h>
+#include <lib/network/stream/mappedFile.h>
 
 namespace agoNetwork {
 	void dealer::
@@ -14,15 +21,17 @@ namespace agoNetwork {
 			const socketModel::tcp& _socket) {
 		if (not _socket.name.empty() && not _socket.address.empty()) {
 			if (validateURI_(_socket.address)) {
+				auto socket = std::make_shared<tcpSocket>(
+						tcpSocket{
+								_socket.name,
+								_socket.address,
+								socketType::dealer,
+								context
+						});
+				socket->heartbeat(_socket.heartbeat);
 				_tcpSocket.insert({
 						_socket.name+"_.:tcp:._",
-						std::make_shared<tcpSocket>(
-								tcpSocket{
-										_socket.name,
-										_socket.address,
-										socketType::dealer,
-										context
-								})
+						socket
 				});
 			}
 			else {
@@ -39,15 +48,17 @@ namespace agoNetwork {
 			const socketModel::ipc& _socket)
 	noexcept {
 		if (not _socket.name.empty() && not _socket.address.empty()) {
+			auto socket = std::make_shared<ipcSocket>(
+					ipcSocket{
+							_socket.name,
+							_socket.address,
+							socketType::dealer,
+							context
+					});
+			socket->heartbeat(_socket.heartbeat);
 			_ipcSocket.insert({
 					_socket.name+"_.:ipc:._",
-					std::make_shared<ipcSocket>(
-							ipcSocket{
-									_socket.name,
-									_socket.address,
-									socketType::dealer,
-									context
-							})
+					socket
 			});
 		}
 	}
@@ -95,25 +106,777 @@ namespace agoNetwork {
 	}
 
 	void dealer::
-	send(const std::string& name, const std::string& message)
-	noexcept {
+	connect_(const std::string& name) noexcept {
+		if (not _connected.insert(name).second) {
+			return;
+		}
 		if (_tcpSocket.contains(name)) {
 			tcpConnect_(name);
-			_tcpSocket[name]->send(
-					_tcpSocket[name]->address(),
-					message);
 		}
 		else if (_ipcSocket.contains(name)) {
 			ipcConnect_(name);
-			_ipcSocket[name]->send(
-					_ipcSocket[name]->address(),
-					message);
 		}
 		else if (_inprocSocket.contains(name)) {
 			inprocConnect_(name);
-			_inprocSocket[name]->send(
-					_inprocSocket[name]->address(),
-					message);
 		}
 	}
+
+	std::string dealer::
+	header_(std::optional<std::uint64_t> request) const noexcept {
+		envelope::header header;
+		if (const auto remaining = deadline::remaining()) {
+			header.budget = static_cast<std::uint32_t>(std::min<std::int64_t>(
+					remaining->count(),
+					std::numeric_limits<std::uint32_t>::max()));
+		}
+		header.request = request;
+		return envelope::encode(header);
+	}
+
+	template<typename function_t>
+	bool dealer::
+	onSocket_(const std::string& name, function_t&& function) const noexcept {
+		if (const auto socket = _tcpSocket.find(name);
+				socket!=_tcpSocket.end()) {
+			function(socket->second);
+			return true;
+		}
+		if (const auto socket = _ipcSocket.find(name);
+				socket!=_ipcSocket.end()) {
+			function(socket->second);
+			return true;
+		}
+		if (const auto socket = _inprocSocket.find(name);
+				socket!=_inprocSocket.end()) {
+			function(socket->second);
+			return true;
+		}
+		return false;
+	}
+
+	std::vector<std::string> dealer::
+	sockets_(const std::string& name) const noexcept {
+		const auto balanced = _balancers.find(name);
+		if (balanced==_balancers.end()) {
+			return { name };
+		}
+		std::vector<std::string> sockets;
+		for (const auto& endpoint : balanced->second->endpoints()) {
+			sockets.push_back(endpoint.name);
+		}
+		return sockets;
+	}
+
+	std::optional<std::uint64_t> dealer::
+	send_(
+			const std::string& name,
+			const std::string& message,
+			const std::string& except) noexcept {
+		if (deadline::expired()) {
+			// nobody waits for the reply anymore
+			return std::nullopt;
+		}
+		expire_();
+		auto socketName = name;
+		const auto balanced = _balancers.find(name);
+		if (balanced!=_balancers.end()) {
+			const auto picked = balanced->second->pick(except);
+			if (not picked) {
+				return std::nullopt;
+			}
+			socketName = *picked;
+		}
+		if (not admit_(socketName)) {
+			// another socket of the logical endpoint could still take it
+			const auto other = balanced!=_balancers.end()
+					? balanced->second->pick(socketName)
+					: std::nullopt;
+			if (not other || *other==socketName || not admit_(*other)) {
+				return std::nullopt;
+			}
+			socketName = *other;
+		}
+		const auto request = _nextRequest++;
+		const auto header = header_(request);
+		connect_(socketName);
+		const auto sent = onSocket_(socketName, [&](const auto& socket) {
+			socket->send(socket->address(), message, header);
+		});
+		if (not sent) {
+			cancel_(socketName);
+			return std::nullopt;
+		}
+		// the reply is awaited from now on
+		_poller.active();
+		const auto guarded = _guards.find(socketName);
+		if (balanced!=_balancers.end() || guarded!=_guards.end()) {
+			const auto now = balancer::clock::now();
+			auto expiry = now;
+			if (balanced!=_balancers.end()) {
+				balanced->second->sent(socketName);
+				expiry += balanced->second->settings().timeout;
+			}
+			else {
+				expiry += guarded->second.breaker->settings().timeout;
+			}
+			_pending.emplace(request, pending{ name, socketName, now, expiry });
+			_nextExpiry = std::min(_nextExpiry, expiry);
+		}
+		return request;
+	}
+
+	std::optional<std::string> dealer::
+	untracked_(const std::string& name) noexcept {
+		auto socketName = name;
+		if (const auto balanced = _balancers.find(name);
+				balanced!=_balancers.end()) {
+			const auto picked = balanced->second->pick();
+			if (not picked) {
+				return std::nullopt;
+			}
+			socketName = *picked;
+		}
+		// untracked messages only respect an open circuit
+		if (const auto guarded = _guards.find(socketName);
+				guarded!=_guards.end()) {
+			if (not guarded->second.breaker->allow()) {
+				return std::nullopt;
+			}
+			guarded->second.breaker->cancel();
+		}
+		connect_(socketName);
+		return socketName;
+	}
+
+	std::size_t dealer::
+	flush_(const std::string& name, packing& packed) noexcept {
+		if (packed.messages==0) {
+			return 0;
+		}
+		const auto messages = std::exchange(packed.messages, 0);
+		const auto socketName = untracked_(name);
+		if (socketName) {
+			envelope::header header;
+			header.packed = messages;
+			onSocket_(*socketName, [&](const auto& socket) {
+				socket->send(
+						socket->address(),
+						packed.frame,
+						envelope::encode(header));
+			});
+		}
+		// keep the capacity of the frame for the next messages
+		packed.frame.clear();
+		return socketName ? messages : 0;
+	}
+
+	void dealer::
+	flushDue_() noexcept {
+		const auto now = balancer::clock::now();
+		for (auto &[name, packed] : _packing) {
+			if (packed.messages>0 && now-packed.first>=packed.window) {
+				flush_(name, packed);
+			}
+		}
+	}
+
+	std::size_t dealer::
+	sendBatch_(
+			const std::string& name,
+			const std::vector<std::string_view>& messages) noexcept {
+		if (messages.empty() || deadline::expired()) {
+			return 0;
+		}
+		const auto socketName = untracked_(name);
+		if (not socketName) {
+			return 0;
+		}
+		const auto header = header_(std::nullopt);
+		std::size_t sent{ 0 };
+		onSocket_(*socketName, [&](const auto& socket) {
+			sent = socket->sendBatch(socket->address(), messages, header);
+		});
+		return sent;
+	}
+
+	std::optional<dealer::reply> dealer::
+	receive_(
+			const std::vector<std::string>& sockets,
+			std::chrono::milliseconds timeout) noexcept {
+		// replies received while streaming come first
+		for (auto stashed = _stashed.begin(); stashed!=_stashed.end();) {
+			if (std::find(sockets.begin(), sockets.end(), stashed->first)==sockets.end()) {
+				++stashed;
+				continue;
+			}
+			auto received = std::move(stashed->second);
+			auto name = std::move(stashed->first);
+			stashed = _stashed.erase(stashed);
+			if (auto _reply = reply_(std::move(received))) {
+				_reply->socket = std::move(name);
+				return _reply;
+			}
+		}
+		std::vector<zmq::pollitem_t> polls;
+		std::vector<std::string> socketPairPoll;
+		for (const auto& name : sockets) {
+			onSocket_(name, [&](const auto& socket) {
+				polls.push_back(
+						zmq::pollitem_t{
+								static_cast<void*>(***socket),
+								0,
+								ZMQ_POLLIN,
+								0
+						}
+				);
+				socketPairPoll.push_back(name);
+			});
+		}
+		if (polls.empty()) {
+			return std::nullopt;
+		}
+		try {
+			_poller.poll(polls, std::max<std::chrono::milliseconds>(
+					timeout, std::chrono::milliseconds{ 0 }).count());
+		}
+		catch (zmq::error_t&) {
+			return std::nullopt;
+		}
+		for (std::size_t socketIndex{ 0 };
+				socketIndex<socketPairPoll.size(); ++socketIndex) {
+			if (not (polls[socketIndex].revents & ZMQ_POLLIN)) {
+				continue;
+			}
+			std::vector<std::string> received;
+			onSocket_(socketPairPoll[socketIndex], [&](const auto& socket) {
+				received = socket->receive();
+			});
+			if (auto _reply = reply_(std::move(received))) {
+				_reply->socket = socketPairPoll[socketIndex];
+				return _reply;
+			}
+		}
+		return std::nullopt;
+	}
+
+	std::optional<dealer::reply> dealer::
+	reply_(std::vector<std::string>&& received) noexcept {
+		if (received.empty()) {
+			return std::nullopt;
+		}
+		reply _reply{
+				.request = std::nullopt,
+				.message = std::move(received.front()),
+				.socket = {},
+				.late = false };
+		if (received.size()>1) {
+			if (const auto header = envelope::decode(received[1])) {
+				if (header->stream) {
+					// a late credit of a finished stream
+					return std::nullopt;
+				}
+				_reply.request = header->request;
+			}
+		}
+		if (_reply.request) {
+			if (const auto request = _pending.find(*_reply.request);
+					request!=_pending.end()) {
+				const auto rtt =
+						std::chrono::duration_cast<std::chrono::microseconds>(
+								balancer::clock::now()-request->second.sent);
+				if (const auto balanced = _balancers.find(request->second.group);
+						balanced!=_balancers.end()) {
+					balanced->second->replied(request->second.endpoint, rtt);
+				}
+				if (const auto hedged = _hedgers.find(request->second.group);
+						hedged!=_hedgers.end()) {
+					hedged->second->observe(rtt);
+				}
+				if (const auto guarded = _guards.find(request->second.endpoint);
+						guarded!=_guards.end()) {
+					guarded->second.breaker->success();
+					guarded->second.limit->release(rtt);
+				}
+				_pending.erase(request);
+			}
+			else {
+				_reply.late = true;
+			}
+			if (_ignored.erase(*_reply.request)) {
+				return std::nullopt;
+			}
+		}
+		return _reply;
+	}
+
+	template<typename chunk_t>
+	bool dealer::
+	stream_(
+			const std::string& name,
+			std::uint64_t total,
+			const streamOptions& options,
+			chunk_t&& sendChunk) noexcept {
+		auto socketName = name;
+		if (const auto balanced = _balancers.find(name);
+				balanced!=_balancers.end()) {
+			const auto picked = balanced->second->pick();
+			if (not picked) {
+				return false;
+			}
+			socketName = *picked;
+		}
+		if (not onSocket_(socketName, [](const auto&) { })) {
+			return false;
+		}
+		connect_(socketName);
+		const std::uint64_t chunkSize = std::max<std::size_t>(options.chunk, 1);
+		// an empty payload is still one chunk, so the router sees its end
+		const auto chunks = std::max<std::uint64_t>((total+chunkSize-1)/chunkSize, 1);
+		const auto id = _nextStream++;
+		std::uint64_t sent{ 0 };
+		std::uint64_t consumed{ 0 };
+		std::uint64_t credits = std::max<std::uint32_t>(options.window, 1);
+		while (consumed<chunks) {
+			for (; credits>0 && sent<chunks; --credits, ++sent) {
+				const auto offset = sent*chunkSize;
+				envelope::header chunk;
+				chunk.stream = id;
+				chunk.offset = offset;
+				chunk.total = total;
+				const auto header = envelope::encode(chunk);
+				onSocket_(socketName, [&](const auto& socket) {
+					sendChunk(socket, header, offset, std::min(chunkSize, total-offset));
+				});
+			}
+			const auto credit = credit_(socketName, id, options.timeout);
+			if (credit==0) {
+				return false;
+			}
+			credits += credit;
+			consumed += credit;
+		}
+		return true;
+	}
+
+	std::uint32_t dealer::
+	credit_(
+			const std::string& name,
+			std::uint64_t id,
+			std::chrono::milliseconds timeout) noexcept {
+		const auto until = balancer::clock::now()+timeout;
+		std::uint32_t credit{ 0 };
+		onSocket_(name, [&](const auto& socket) {
+			zmq::pollitem_t poll{ static_cast<void*>(***socket), 0, ZMQ_POLLIN, 0 };
+			while (credit==0) {
+				const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+						until-balancer::clock::now());
+				if (left.count()<0) {
+					return;
+				}
+				try {
+					zmq::poll(&poll, 1, left.count());
+				}
+				catch (zmq::error_t&) {
+					return;
+				}
+				if (not (poll.revents & ZMQ_POLLIN)) {
+					continue;
+				}
+				auto received = socket->receive();
+				if (received.empty()) {
+					continue;
+				}
+				const auto header = received.size()>1
+						? envelope::decode(received[1])
+						: std::nullopt;
+				if (header && header->stream) {
+					// credits of another stream are stale
+					if (*header->stream==id && header->credit) {
+						credit = *header->credit;
+					}
+					continue;
+				}
+				_stashed.emplace_back(name, std::move(received));
+			}
+		});
+		return credit;
+	}
+
+	void dealer::
+	expire_() noexcept {
+		const auto now = balancer::clock::now();
+		if (now<_nextExpiry) {
+			return;
+		}
+		_nextExpiry = balancer::clock::time_point::max();
+		for (auto request = _pending.begin(); request!=_pending.end();) {
+			if (request->second.expiry<=now) {
+				fail_((request++)->first);
+			}
+			else {
+				_nextExpiry = std::min(_nextExpiry, request->second.expiry);
+				++request;
+			}
+		}
+	}
+
+	bool dealer::
+	admit_(const std::string& name) noexcept {
+		const auto guarded = _guards.find(name);
+		if (guarded==_guards.end()) {
+			return true;
+		}
+		if (not guarded->second.breaker->allow()) {
+			return false;
+		}
+		if (not guarded->second.limit->acquire()) {
+			guarded->second.breaker->cancel();
+			return false;
+		}
+		return true;
+	}
+
+	void dealer::
+	cancel_(const std::string& name) noexcept {
+		if (const auto guarded = _guards.find(name);
+				guarded!=_guards.end()) {
+			guarded->second.breaker->cancel();
+			guarded->second.limit->cancel();
+		}
+	}
+
+	void dealer::
+	fail_(std::uint64_t id) noexcept {
+		const auto request = _pending.find(id);
+		if (request==_pending.end()) {
+			return;
+		}
+		if (const auto balanced = _balancers.find(request->second.group);
+				balanced!=_balancers.end()) {
+			balanced->second->failed(request->second.endpoint);
+		}
+		if (const auto guarded = _guards.find(request->second.endpoint);
+				guarded!=_guards.end()) {
+			guarded->second.breaker->failure();
+			guarded->second.limit->release(std::nullopt);
+		}
+		_ignored.erase(id);
+		_pending.erase(request);
+	}
+
+	void dealer::
+	ignore_(std::uint64_t id) noexcept {
+		if (_pending.contains(id)) {
+			_ignored.insert(id);
+		}
+	}
+
+	bool dealer::
+	send(const std::string& name, const std::string& message)
+	noexcept {
+		flushDue_();
+		if (const auto packed = _packing.find(name);
+				packed!=_packing.end() && not deadline::remaining()) {
+			auto& frame = packed->second;
+			const auto now = balancer::clock::now();
+			if (frame.messages==0) {
+				frame.first = now;
+			}
+			envelope::pack(frame.frame, message);
+			++frame.messages;
+			if (frame.messages>=frame.count
+					|| frame.frame.size()>=frame.bytes
+					|| now-frame.first>=frame.window) {
+				return flush_(name, frame)>0;
+			}
+			return true;
+		}
+		// nothing waits for its reply, so it is not tracked as a request
+		if (deadline::expired()) {
+			return false;
+		}
+		const auto socketName = untracked_(name);
+		if (not socketName) {
+			return false;
+		}
+		const auto header = header_(std::nullopt);
+		const auto sent = onSocket_(*socketName, [&](const auto& socket) {
+			socket->send(socket->address(), message, header);
+		});
+		if (sent) {
+			_poller.active();
+		}
+		return sent;
+	}
+
+	bool dealer::
+	send(
+			const std::string& name,
+			const std::string& message,
+			std::chrono::milliseconds budget)
+	noexcept {
+		const deadline scope{ budget };
+		return send(name, message);
+	}
+
+	void dealer::
+	pack(
+			const std::string& name,
+			std::size_t count,
+			std::chrono::microseconds window,
+			std::size_t bytes) noexcept {
+		if (const auto packed = _packing.find(name);
+				packed!=_packing.end()) {
+			flush_(name, packed->second);
+			_packing.erase(packed);
+		}
+		if (count>1) {
+			_packing.emplace(name, packing{
+					.count = count,
+					.bytes = bytes,
+					.window = window,
+					.frame = {},
+					.messages = 0,
+					.first = {} });
+		}
+	}
+
+	std::size_t dealer::
+	flush(const std::string& name) noexcept {
+		const auto packed = _packing.find(name);
+		return packed==_packing.end() ? 0 : flush_(name, packed->second);
+	}
+
+	void dealer::
+	balance(
+			const std::string& name,
+			const std::vector<std::string>& sockets,
+			balancePolicy policy,
+			balanceOptions options) noexcept {
+		std::vector<std::string> registered;
+		for (const auto& socket : sockets) {
+			if (_tcpSocket.contains(socket)
+					|| _ipcSocket.contains(socket)
+					|| _inprocSocket.contains(socket)) {
+				registered.push_back(socket);
+			}
+		}
+		if (not registered.empty()) {
+			_balancers[name] =
+					std::make_unique<balancer>(registered, policy, options);
+		}
+	}
+
+	std::optional<std::string> dealer::
+	receive(const std::string& name, std::chrono::milliseconds timeout)
+	noexcept {
+		flushDue_();
+		expire_();
+		const deadline scope{ timeout };
+		const auto sockets = sockets_(name);
+		while (not deadline::expired()) {
+			if (auto _reply = receive_(sockets, *deadline::remaining())) {
+				return std::move(_reply->message);
+			}
+		}
+		return std::nullopt;
+	}
+
+	std::optional<std::string> dealer::
+	request(
+			const std::string& name,
+			const std::string& message,
+			std::chrono::milliseconds timeout) noexcept {
+		flushDue_();
+		const deadline scope{ timeout };
+		const auto request = send_(name, message);
+		if (not request) {
+			return std::nullopt;
+		}
+		// a slow request is sent again to another socket at the hedge time
+		const auto hedged = _hedgers.find(name);
+		std::optional<balancer::clock::time_point> hedgeAt;
+		if (hedged!=_hedgers.end() && _pending.contains(*request)) {
+			if (const auto delay = hedged->second->request()) {
+				hedgeAt = balancer::clock::now()+*delay;
+			}
+		}
+		std::optional<std::uint64_t> hedge;
+		const auto sockets = sockets_(name);
+		// other replies are stashed once the request is over, otherwise
+		// they are received again and again meanwhile
+		std::vector<std::pair<std::string, std::vector<std::string>>> others;
+		const auto stash = [this, &others] {
+			std::move(others.begin(), others.end(), std::back_inserter(_stashed));
+		};
+		while (not deadline::expired()) {
+			auto wait = *deadline::remaining();
+			if (hedgeAt) {
+				wait = std::min(wait,
+						std::chrono::ceil<std::chrono::milliseconds>(
+								*hedgeAt-balancer::clock::now()));
+			}
+			auto _reply = receive_(sockets, wait);
+			if (_reply && (_reply->request==request
+					|| (hedge && _reply->request==hedge))) {
+				// the loser is replied to nobody
+				if (hedge) {
+					ignore_(_reply->request==request ? *hedge : *request);
+					if (_reply->request==hedge) {
+						hedged->second->won();
+					}
+				}
+				stash();
+				return std::move(_reply->message);
+			}
+			if (_reply && not _reply->late) {
+				// the reply of a plain send is still received later
+				others.emplace_back(
+						std::move(_reply->socket),
+						std::vector<std::string>{ std::move(_reply->message) });
+			}
+			if (hedgeAt && balancer::clock::now()>=*hedgeAt) {
+				hedgeAt.reset();
+				if (const auto original = _pending.find(*request);
+						original!=_pending.end() && hedged->second->acquire()) {
+					hedge = send_(name, message, original->second.endpoint);
+				}
+			}
+		}
+		stash();
+		fail_(*request);
+		if (hedge) {
+			fail_(*hedge);
+		}
+		return std::nullopt;
+	}
+
+	void dealer::
+	hedge(const std::string& name, double percentile, double budget) noexcept {
+		if (_balancers.contains(name)) {
+			_hedgers[name] = std::make_unique<hedger>(percentile, budget);
+		}
+	}
+
+	hedger::statistics dealer::
+	hedging(const std::string& name) const noexcept {
+		const auto hedged = _hedgers.find(name);
+		return hedged==_hedgers.end()
+				? hedger::statistics{}
+				: hedged->second->stats();
+	}
+
+	void dealer::
+	protect(
+			const std::string& name,
+			breakerOptions breaker,
+			limitOptions limit) noexcept {
+		for (const auto& socket : sockets_(name)) {
+			if (_tcpSocket.contains(socket)
+					|| _ipcSocket.contains(socket)
+					|| _inprocSocket.contains(socket)) {
+				_guards[socket] = guard{
+						std::make_unique<circuitBreaker>(breaker),
+						std::make_unique<concurrencyLimit>(limit)
+				};
+			}
+		}
+	}
+
+	circuitBreaker::statistics dealer::
+	circuit(const std::string& name) const noexcept {
+		const auto guarded = _guards.find(name);
+		return guarded==_guards.end()
+				? circuitBreaker::statistics{}
+				: guarded->second.breaker->stats();
+	}
+
+	concurrencyLimit::statistics dealer::
+	concurrency(const std::string& name) const noexcept {
+		const auto guarded = _guards.find(name);
+		return guarded==_guards.end()
+				? concurrencyLimit::statistics{}
+				: guarded->second.limit->stats();
+	}
+
+	std::vector<balancer::endpoint> dealer::
+	endpoints(const std::string& name) const noexcept {
+		const auto balanced = _balancers.find(name);
+		return balanced==_balancers.end()
+				? std::vector<balancer::endpoint>{}
+				: balanced->second->endpoints();
+	}
+
+	bool dealer::
+	compress(const std::string& name, compressionOptions options) noexcept {
+		// the sockets of a logical endpoint share one compressor
+		const auto _compressor = std::make_shared<compressor>(std::move(options));
+		bool registered{ false };
+		for (const auto& socketName : sockets_(name)) {
+			registered |= onSocket_(socketName, [&](const auto& socket) {
+				socket->compress(_compressor);
+			});
+		}
+		return registered;
+	}
+
+	std::optional<compressor::statistics> dealer::
+	compression(const std::string& name) const noexcept {
+		const auto sockets = sockets_(name);
+		if (sockets.empty()) {
+			return std::nullopt;
+		}
+		std::shared_ptr<compressor> _compressor;
+		onSocket_(sockets.front(), [&](const auto& socket) {
+			_compressor = socket->compression();
+		});
+		if (not _compressor) {
+			return std::nullopt;
+		}
+		return _compressor->stats();
+	}
+
+	bool dealer::
+	stream(
+			const std::string& name,
+			std::string_view payload,
+			streamOptions options) noexcept {
+		return stream_(name, payload.size(), options, [payload](
+				const auto& socket,
+				const std::string& header,
+				std::uint64_t offset,
+				std::uint64_t size) {
+			socket->sendBatch(socket->address(), { payload.substr(offset, size) }, header);
+		});
+	}
+
+	bool dealer::
+	streamFile(
+			const std::string& name,
+			const std::string& path,
+			streamOptions options) noexcept {
+		std::shared_ptr<const mappedFile> file;
+		try {
+			file = std::make_shared<const mappedFile>(path);
+		}
+		catch (...) {
+			return false;
+		}
+		if (not file->valid()) {
+			return false;
+		}
+		// each chunk keeps the mapping alive until zmq is done with it
+		return stream_(name, file->view().size(), options, [&file](
+				const auto& socket,
+				const std::string& header,
+				std::uint64_t offset,
+				std::uint64_t size) {
+			socket->sendShared(socket->address(), file, file->view().substr(offset, size), header);
+		});
+	}
+
+	void dealer::
+	busyPoll(const busyPollOptions& options) noexcept {
+		_poller = busyPoller{ options.spin };
+	}
 }
@@ -8,8 +8,20 @@
 #ifndef AGO_NETWORK_DEALER_H
 #define AGO_NETWORK_DEALER_H
 
+#include <chrono>
+#include <deque>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 #include <lib/concepts/concepts.h>
 #include <lib/network/zmq/zmqContext.h>
+#include <lib/network/balancer/balancer.h>
+#include <lib/network/hedger/hedger.h>
+#include <lib/network/breaker/circuitBreaker.h>
+#include <lib/network/limiter/concurrencyLimit.h>
+#include <lib/network/stream/stream.h>
+#include <lib/network/poller/busyPoller.h>
 
 namespace agoNetwork {
 	/// @brief **dealer** is the *zmq dealer* adapter
@@ -25,6 +37,70 @@ namespace agoNetwork {
 		/// Maps socket name to a inprocSocket shared pointer.
 		std::unordered_map
 				<std::string, std::shared_ptr<inprocSocket>> _inprocSocket;
+		/// Maps the name of a logical endpoint to the balancer of its sockets.
+		std::unordered_map<std::string, std::unique_ptr<balancer>> _balancers;
+		/// Maps the name of a logical endpoint to its hedger.
+		std::unordered_map<std::string, std::unique_ptr<hedger>> _hedgers;
+		/// Ids of the requests which lost the race to their hedge (or the
+		/// other way around), their replies are dropped.
+		std::unordered_set<std::uint64_t> _ignored;
+		/// @brief Protects a socket from piling up requests.
+		struct guard {
+			std::unique_ptr<circuitBreaker> breaker;
+			std::unique_ptr<concurrencyLimit> limit;
+		};
+		/// Maps socket name to its guard.
+		std::unordered_map<std::string, guard> _guards;
+		/// Names of the sockets which are connected.
+		std::unordered_set<std::string> _connected;
+		/// @brief Messages waiting to be sent together as one packed frame.
+		struct packing {
+			/// The frame is sent once it packs this many messages,
+			std::size_t count;
+			/// or this many bytes,
+			std::size_t bytes;
+			/// or its first message waited this long.
+			std::chrono::microseconds window;
+			/// The packed messages.
+			/// @see agoNetwork::envelope::pack
+			std::string frame;
+			std::uint32_t messages{ 0 };
+			balancer::clock::time_point first{};
+		};
+		/// Maps socket or logical endpoint name to its packing.
+		std::unordered_map<std::string, packing> _packing;
+		/// Id of the next request.
+		std::uint64_t _nextRequest{ 0 };
+		/// @brief A request of a logical endpoint waiting for its reply.
+		struct pending {
+			/// Name of the logical endpoint.
+			std::string group;
+			/// Name of the socket which the request is sent to.
+			std::string endpoint;
+			balancer::clock::time_point sent;
+			/// The request fails if it is not replied by then.
+			balancer::clock::time_point expiry;
+		};
+		/// Maps request id to the pending requests.
+		std::map<std::uint64_t, pending> _pending;
+		/// The earliest expiry of the pending requests.
+		balancer::clock::time_point _nextExpiry{ balancer::clock::time_point::max() };
+		/// @brief A received reply and the id of its request, if echoed.
+		struct reply {
+			std::optional<std::uint64_t> request;
+			std::string message;
+			/// The socket which received it.
+			std::string socket;
+			/// Whether its request failed already, nobody waits for it.
+			bool late{ false };
+		};
+		/// Id of the next stream.
+		std::uint64_t _nextStream{ 0 };
+		/// Replies received while waiting for the credits of a stream or
+		/// for the reply of another request, by the name of their socket.
+		std::deque<std::pair<std::string, std::vector<std::string>>> _stashed;
+		/// Spins on the sockets while a reply is awaited, if busy polling.
+		busyPoller _poller;
 
 	public: // constructors and destructors
 		/// @brief Registers sockets.
@@ -43,6 +119,18 @@ namespace agoNetwork {
 			(registerSocket_(_context, socket), ...);
 		}
 
+		/// @brief Registers sockets on a shared context.
+		/// @note inproc sockets must share the context with their pairs.
+		/// @param context is the shared zmq context.
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		dealer(std::shared_ptr<zmq::context_t> context, socket_t ... socket)
+		noexcept
+				:zmqContext{ std::move(context) } {
+			(registerSocket_(_context, socket), ...);
+		}
+
 	private:
 		/// @brief Registers tcp sockets in router::_tcpSocket.
 		/// @warning This function could throw a runtime error if the specified
@@ -74,6 +162,10 @@ namespace agoNetwork {
 		/// connect to its address.
 		void
 		inprocConnect_(const std::string&) noexcept;
+		/// @brief Make the specified socket (by its name) connect to its
+		/// address unless it is already connected.
+		void
+		connect_(const std::string&) noexcept;
 
 	private:
 		/// @brief Validate specified uri for the tcp protocol.
@@ -83,11 +175,320 @@ namespace agoNetwork {
 		bool
 		validateURI_(const std::string&) const noexcept;
 
+		/// @brief Make the header frame of a request.
+		/// It carries the request id, if any, and the remaining budget of the
+		/// current deadline, if any.
+		/// @see agoNetwork::deadline
+		/// @return The encoded header.
+		[[nodiscard]]
+		std::string
+		header_(std::optional<std::uint64_t>) const noexcept;
+
+		/// @brief Run the function on the registered socket of the specified
+		/// name, whichever its protocol is.
+		/// @return true if the socket is registered and false otherwise.
+		template<typename function_t>
+		bool
+		onSocket_(const std::string&, function_t&&) const noexcept;
+
+		/// @brief Specify the sockets of a logical endpoint or the socket
+		/// itself if the name is not a logical endpoint.
+		[[nodiscard]]
+		std::vector<std::string>
+		sockets_(const std::string&) const noexcept;
+
+		/// @brief Send a request to a socket or to a socket of a logical
+		/// endpoint picked by its balancer, its reply is awaited.
+		/// @param except A socket which should not be picked unless it is the
+		/// only one.
+		/// @return The request id or nothing if nothing is sent.
+		std::optional<std::uint64_t>
+		send_(const std::string&, const std::string&,
+				const std::string& except = {}) noexcept;
+
+		/// @brief Pick the socket of a message which is not tracked (batched
+		/// or packed), the socket of an open circuit is not picked.
+		/// @return Name of the socket or nothing if there is none.
+		std::optional<std::string>
+		untracked_(const std::string&) noexcept;
+
+		/// @brief Send the packed messages of a socket or logical endpoint.
+		/// @return Number of the sent messages.
+		std::size_t
+		flush_(const std::string&, packing&) noexcept;
+
+		/// @brief Send the packed frames whose window is over.
+		void
+		flushDue_() noexcept;
+
+		/// @brief Send a batch of messages to a socket or to a socket of a
+		/// logical endpoint picked once for the whole batch.
+		/// @return Number of the sent messages.
+		std::size_t
+		sendBatch_(const std::string&, const std::vector<std::string_view>&)
+		noexcept;
+
+		/// @brief Receive a reply on any of the specified sockets within the
+		/// timeout, the reply of a pending request is counted by its balancer.
+		/// @return The reply or nothing if the timeout is over.
+		std::optional<reply>
+		receive_(const std::vector<std::string>&, std::chrono::milliseconds)
+		noexcept;
+
+		/// @brief Make a reply out of a received message, the reply of a
+		/// pending request is counted by its balancer.
+		/// @return The reply or nothing if it should be dropped.
+		std::optional<reply>
+		reply_(std::vector<std::string>&&) noexcept;
+
+		/// @brief Send a payload to a socket (or to a socket of a logical
+		/// endpoint) in chunks, as many as the router grants credits for.
+		/// @return true if the router consumed every chunk.
+		template<typename chunk_t>
+		bool
+		stream_(const std::string&, std::uint64_t, const streamOptions&, chunk_t&&)
+		noexcept;
+
+		/// @brief Wait for the credits of a stream on a socket, other
+		/// replies are stashed for dealer::receive.
+		/// @return Number of the granted chunks, zero if the timeout is over.
+		std::uint32_t
+		credit_(const std::string&, std::uint64_t, std::chrono::milliseconds)
+		noexcept;
+
+		/// @brief Count the pending requests which are not replied in time
+		/// as failures of their sockets.
+		void
+		expire_() noexcept;
+
+		/// @brief Take a slot of the guard of a socket, if any.
+		/// @return true if a request could be sent to the socket and false
+		/// if it should fail fast.
+		bool
+		admit_(const std::string&) noexcept;
+
+		/// @brief Give back the slot of a request which is not sent after all.
+		void
+		cancel_(const std::string&) noexcept;
+
+		/// @brief Forget a pending request, counting it as a failure.
+		void
+		fail_(std::uint64_t) noexcept;
+
+		/// @brief Drop the reply of a pending request once it arrives.
+		void
+		ignore_(std::uint64_t) noexcept;
+
 	public: // public methods
 		/// @brief Make the specified inproc socket (by its name)
 		/// send a message to its connected pair.
-		void
+		/// If the calling thread has a deadline (e.g. inside a router
+		/// callback) its remaining budget is attached to the request, and an
+		/// expired request is not sent at all.
+		/// Its reply is not awaited, so it is not counted by the balancer,
+		/// the circuit or the concurrency limit of the socket, see
+		/// dealer::request for that.
+		/// @return true if the message is sent and false if it is not, e.g.
+		/// the circuit of the socket is open.
+		bool
 		send(const std::string&, const std::string&) noexcept;
+
+		/// @brief Send a message which should be handled within the
+		/// specified budget, otherwise the router drops it.
+		/// @return true if the message is sent and false otherwise.
+		bool
+		send(const std::string&, const std::string&, std::chrono::milliseconds)
+		noexcept;
+
+		/// @brief Send many messages to a socket (or to a single socket of a
+		/// logical endpoint) at once.
+		/// The socket is looked up, checked and connected once for the batch
+		/// and the frames are written straight from the payloads.
+		/// The messages carry the budget of the current deadline but no
+		/// request id, so they are fire and forget: their replies are not
+		/// matched, balanced or counted by the guards.
+		/// @tparam range_t is ::payloadRange concept, e.g. a vector of
+		/// strings or string views.
+		/// @param name Name of the registered socket or the logical endpoint
+		/// @param payloads The messages
+		/// @return Number of the sent messages.
+		template<payloadRange range_t>
+		std::size_t
+		sendBatch(const std::string& name, const range_t& payloads) noexcept {
+			std::vector<std::string_view> messages;
+			if constexpr (std::ranges::sized_range<range_t>) {
+				messages.reserve(std::ranges::size(payloads));
+			}
+			for (const auto& payload : payloads) {
+				messages.emplace_back(payload);
+			}
+			return sendBatch_(name, messages);
+		}
+
+		/// @brief Pack the messages sent to a socket (or logical endpoint)
+		/// into frames of many messages, which the router splits again.
+		/// Sending a message only appends it to the current frame, which is
+		/// sent once it holds the count of messages or bytes, or once its
+		/// first message has waited for the window. The dealer has no thread
+		/// of its own, so an overdue frame is sent by the next call of
+		/// dealer::send, dealer::receive or dealer::request, and
+		/// dealer::flush sends it right away.
+		/// Like batches, packed messages are not tracked, and messages sent
+		/// within a deadline (they carry a budget) are never packed.
+		/// @param name Name of the registered socket or the logical endpoint
+		/// @param count Messages per frame, below two turns packing off
+		/// @param window How long a message could wait for the others
+		/// @param bytes Bytes per frame
+		void
+		pack(
+				const std::string& name,
+				std::size_t count,
+				std::chrono::microseconds window,
+				std::size_t bytes = 64*1024) noexcept;
+
+		/// @brief Send the packed messages of a socket or logical endpoint.
+		/// @return Number of the sent messages.
+		std::size_t
+		flush(const std::string&) noexcept;
+
+		/// @brief Make a logical endpoint which spreads its requests over the
+		/// specified sockets, so each of them could connect to a router of its
+		/// own. Sending to the logical endpoint picks one of the sockets by
+		/// the policy, sockets failing (not replying in time) in a row are
+		/// ejected for a while and probed again afterwards.
+		/// @note The latency and the failures are observed through the
+		/// replies, see dealer::receive and dealer::request.
+		/// @param name Name of the logical endpoint
+		/// @param sockets Names of the registered sockets
+		/// @param policy How the socket of a request is picked
+		/// @param options Ejection options
+		void
+		balance(
+				const std::string& name,
+				const std::vector<std::string>& sockets,
+				balancePolicy policy = balancePolicy::roundRobin,
+				balanceOptions options = {}) noexcept;
+
+		/// @brief Receive a reply on a socket (or on any socket of a logical
+		/// endpoint) within the timeout.
+		/// @return The reply or nothing if the timeout is over.
+		std::optional<std::string>
+		receive(const std::string&, std::chrono::milliseconds) noexcept;
+
+		/// @brief Send a request and wait for its reply within the timeout,
+		/// which is the budget of the request as well.
+		/// Other replies which arrive meanwhile are kept for dealer::receive,
+		/// unless their requests failed already.
+		/// A hedged logical endpoint sends a duplicate to another socket once
+		/// the request is slower than the hedge delay, the first reply wins.
+		/// @see dealer::hedge
+		/// @return The reply or nothing if the timeout is over.
+		std::optional<std::string>
+		request(
+				const std::string&,
+				const std::string&,
+				std::chrono::milliseconds) noexcept;
+
+		/// @brief Hedge the requests of a logical endpoint.
+		/// A request which is not replied within the specified percentile of
+		/// the recent round trip times is sent again to another socket, as
+		/// long as the budget allows.
+		/// @param name Name of the logical endpoint, see dealer::balance
+		/// @param percentile The percentile of the hedge delay
+		/// @param budget The fraction of the requests which could be hedged
+		void
+		hedge(const std::string& name, double percentile = 0.95,
+				double budget = 0.05) noexcept;
+
+		/// @brief Specify the requests, hedges and wins of a logical endpoint.
+		[[nodiscard]]
+		hedger::statistics
+		hedging(const std::string&) const noexcept;
+
+		/// @brief Protect a socket (or each socket of a logical endpoint) by a
+		/// circuit breaker and an adaptive concurrency limit.
+		/// Requests to an open circuit or beyond the limit fail fast instead
+		/// of queueing up in front of a slow router, a logical endpoint picks
+		/// another socket for them if it could.
+		/// @param name Name of the registered socket or the logical endpoint
+		/// @param breaker Options of the circuit breaker
+		/// @param limit Options of the concurrency limit
+		void
+		protect(
+				const std::string& name,
+				breakerOptions breaker = {},
+				limitOptions limit = {}) noexcept;
+
+		/// @brief Specify the state of the circuit breaker of a socket.
+		[[nodiscard]]
+		circuitBreaker::statistics
+		circuit(const std::string&) const noexcept;
+
+		/// @brief Specify the concurrency limit of a socket.
+		[[nodiscard]]
+		concurrencyLimit::statistics
+		concurrency(const std::string&) const noexcept;
+
+		/// @brief Specify what is observed of the sockets of a logical
+		/// endpoint.
+		[[nodiscard]]
+		std::vector<balancer::endpoint>
+		endpoints(const std::string&) const noexcept;
+
+		/// @brief Stream a large payload to a socket (or to a socket of a
+		/// logical endpoint) in chunks, see router::registerStream.
+		/// At most options.window chunks are in flight, each consumed chunk
+		/// grants one more, so neither side holds the whole payload in its
+		/// queues. Each chunk is copied once into its zmq message.
+		/// @param name Name of the socket or logical endpoint
+		/// @param payload The payload, it should outlive the call
+		/// @param options Chunk size, window and credit timeout
+		/// @return true if the router consumed every chunk and false if a
+		/// credit is not granted in time.
+		bool
+		stream(
+				const std::string& name,
+				std::string_view payload,
+				streamOptions options = {}) noexcept;
+
+		/// @brief Stream a file like dealer::stream, the file is mapped into
+		/// memory and its chunks are sent without being read or copied.
+		/// @param name Name of the socket or logical endpoint
+		/// @param path Path of the file
+		/// @param options Chunk size, window and credit timeout
+		/// @return true if the router consumed every chunk and false if the
+		/// file could not be mapped or a credit is not granted in time.
+		bool
+		streamFile(
+				const std::string& name,
+				const std::string& path,
+				streamOptions options = {}) noexcept;
+
+		/// @brief Compress the requests of a socket, or of each socket of a
+		/// logical endpoint, which are long enough and do shrink.
+		/// The replies are decompressed whether or not the socket compresses.
+		/// @note It should be called before sending on the socket.
+		/// @return true if the socket is registered and false otherwise.
+		bool
+		compress(const std::string& name, compressionOptions options = {})
+		noexcept;
+
+		/// @brief Specify what the compressor of a socket did so far.
+		/// @return The statistics or nothing if the socket does not compress.
+		[[nodiscard]]
+		std::optional<compressor::statistics>
+		compression(const std::string&) const noexcept;
+
+		/// @brief Make the dealer spin on its sockets for the spin period
+		/// once a request is sent (or a reply is received) instead of
+		/// sleeping in zmq::poll, so the replies are picked up with the
+		/// least latency. Waiting longer than the spin period blocks.
+		/// @note The dealer runs on the calling thread, so the CPUs of the
+		/// options are ignored, the caller could pin its own thread by
+		/// agoNetwork::busyPoller::pin.
+		/// @param options The spin period
+		void
+		busyPoll(const busyPollOptions& options) noexcept;
 	};
 }
 
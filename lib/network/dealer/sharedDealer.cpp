@@ -0,0 +1,141 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 12:40
+//
+
+#include <atomic>
+#include <lib/network/dealer/sharedDealer.h>
+
+namespace agoNetwork {
+	namespace {
+		/// Id of the next shared dealer.
+		std::atomic<std::uint64_t> nextId{ 0 };
+
+		/// @brief The dealers of the calling thread by the id of their
+		/// shared dealer, looked up without any lock.
+		/// The entries of the destroyed shared dealers are pruned once the
+		/// thread makes a new dealer, so a thread which outlives many
+		/// shared dealers keeps at most the ones destroyed since then.
+		struct locals {
+			struct entry {
+				dealer* _dealer;
+				/// Expires with the shared dealer, the dealer is closed by then.
+				std::weak_ptr<void> owner;
+				/// Removes the dealer from its shared dealer, if it is alive.
+				std::function<void()> forget;
+			};
+			std::unordered_map<std::uint64_t, entry> entries;
+
+			/// @brief Close the dealers of the thread once it exits.
+			~locals() {
+				for (auto &[id, _entry] : entries) {
+					_entry.forget();
+				}
+			}
+		};
+
+		thread_local locals currentLocals;
+	}
+
+	sharedDealer::
+	~sharedDealer() {
+		std::lock_guard lock{ _registry->mutex };
+		_registry->dealers.clear();
+	}
+
+	std::uint64_t sharedDealer::
+	id_() noexcept {
+		return nextId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void sharedDealer::
+	configure(setup _setup) noexcept {
+		std::lock_guard lock{ _registry->mutex };
+		_registry->_setup = std::move(_setup);
+	}
+
+	dealer& sharedDealer::
+	local() noexcept {
+		auto& entries = currentLocals.entries;
+		if (const auto found = entries.find(_id); found!=entries.end()) {
+			return *found->second._dealer;
+		}
+		std::erase_if(entries, [](const auto& _entry) {
+			return _entry.second.owner.expired();
+		});
+		auto _dealer = _factory(_contextHandle);
+		setup _setup;
+		{
+			std::lock_guard lock{ _registry->mutex };
+			_registry->dealers.emplace(std::this_thread::get_id(), _dealer);
+			_setup = _registry->_setup;
+		}
+		if (_setup) {
+			_setup(*_dealer);
+		}
+		entries.emplace(_id, locals::entry{
+				_dealer.get(),
+				_registry,
+				[weak = std::weak_ptr{ _registry }, thread = std::this_thread::get_id()] {
+					if (const auto _registry_ = weak.lock()) {
+						std::lock_guard lock{ _registry_->mutex };
+						_registry_->dealers.erase(thread);
+					}
+				}});
+		return *_dealer;
+	}
+
+	std::size_t sharedDealer::
+	threads() const noexcept {
+		std::lock_guard lock{ _registry->mutex };
+		return _registry->dealers.size();
+	}
+
+	bool sharedDealer::
+	send(const std::string& name, const std::string& message) noexcept {
+		return local().send(name, message);
+	}
+
+	bool sharedDealer::
+	send(
+			const std::string& name,
+			const std::string& message,
+			std::chrono::milliseconds budget) noexcept {
+		return local().send(name, message, budget);
+	}
+
+	std::size_t sharedDealer::
+	flush(const std::string& name) noexcept {
+		return local().flush(name);
+	}
+
+	std::optional<std::string> sharedDealer::
+	receive(const std::string& name, std::chrono::milliseconds timeout) noexcept {
+		return local().receive(name, timeout);
+	}
+
+	std::optional<std::string> sharedDealer::
+	request(
+			const std::string& name,
+			const std::string& message,
+			std::chrono::milliseconds timeout) noexcept {
+		return local().request(name, message, timeout);
+	}
+
+	bool sharedDealer::
+	stream(
+			const std::string& name,
+			std::string_view payload,
+			streamOptions options) noexcept {
+		return local().stream(name, payload, options);
+	}
+
+	bool sharedDealer::
+	streamFile(
+			const std::string& name,
+			const std::string& path,
+			streamOptions options) noexcept {
+		return local().streamFile(name, path, options);
+	}
+}
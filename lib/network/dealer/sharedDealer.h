@@ -0,0 +1,161 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:41
+//
+
+#ifndef AGO_NETWORK_SHARED_DEALER_H
+#define AGO_NETWORK_SHARED_DEALER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <lib/network/dealer/dealer.h>
+
+namespace agoNetwork {
+	/// @brief **sharedDealer** is a dealer which could be called from many
+	/// threads at once.
+	/// Each calling thread gets a dealer of its own, made on the first call
+	/// out of the same sockets and the same zmq context, so the threads
+	/// never lock each other out and share the IO threads of the context.
+	/// A reply comes back to the socket of the thread which sent the
+	/// request, so dealer::request and dealer::receive work as they do on a
+	/// single thread.
+	/// @note The balancers, hedgers and guards configured by
+	/// sharedDealer::configure are per thread as well, e.g. a concurrency
+	/// limit bounds the requests of each thread.
+	class sharedDealer final : private zmqContext {
+	private: // private data
+		/// factory is a function alias which makes a dealer of the
+		/// registered sockets on the specified context.
+		using factory =
+		std::function<std::shared_ptr<dealer>(const std::shared_ptr<zmq::context_t>&)>;
+		/// setup is a function alias which configures the dealer of a thread.
+		using setup = std::function<void(dealer&)>;
+		/// @brief The dealers of the threads, by thread.
+		struct registry {
+			std::mutex mutex;
+			std::unordered_map<std::thread::id, std::shared_ptr<dealer>> dealers;
+			setup _setup;
+		};
+		/// Tells the shared dealers apart in the tables of the threads,
+		/// which outlive them, unlike their addresses it is never reused.
+		std::uint64_t _id;
+		factory _factory;
+		std::shared_ptr<registry> _registry{ std::make_shared<registry>() };
+
+	public: // constructors and destructors
+		/// @brief Registers sockets, the dealers of the threads are made of
+		/// them on a context of a single IO thread.
+		/// @tparam socket_t is ::Socket concept.
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		sharedDealer(socket_t ... socket) noexcept
+				:_id{ id_() },
+				 _factory{ factory_(socket...) } {}
+
+		/// @brief Registers sockets, the dealers of the threads are made of
+		/// them on a shared context.
+		/// @note inproc sockets must share the context with their pairs.
+		/// @param context is the shared zmq context.
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		sharedDealer(std::shared_ptr<zmq::context_t> context, socket_t ... socket)
+		noexcept
+				:zmqContext{ std::move(context) },
+				 _id{ id_() },
+				 _factory{ factory_(socket...) } {}
+
+		sharedDealer(const sharedDealer&) = delete;
+
+		sharedDealer&
+		operator=(const sharedDealer&) = delete;
+
+		/// @brief Close the dealers of all the threads.
+		/// @warning No thread should be calling it meanwhile.
+		~sharedDealer();
+
+	private: // private methods
+		/// @brief Make the id of a new shared dealer.
+		static std::uint64_t
+		id_() noexcept;
+
+		template<Socket... socket_t>
+		static factory
+		factory_(socket_t ... socket) noexcept {
+			return [socket...](const std::shared_ptr<zmq::context_t>& context) {
+				return std::make_shared<dealer>(context, socket...);
+			};
+		}
+
+	public: // public methods
+		/// @brief Configure the dealer of each thread once it is made,
+		/// e.g. by dealer::balance, dealer::protect or dealer::pack.
+		/// @note It should be called before any thread uses the dealer,
+		/// the dealers made already are not configured.
+		void
+		configure(setup) noexcept;
+
+		/// @brief Specify the dealer of the calling thread, made on the
+		/// first call. It should not be handed to another thread.
+		dealer&
+		local() noexcept;
+
+		/// @brief Specify the number of the threads which have a dealer.
+		[[nodiscard]]
+		std::size_t
+		threads() const noexcept;
+
+		/// @see dealer::send
+		bool
+		send(const std::string&, const std::string&) noexcept;
+
+		/// @see dealer::send
+		bool
+		send(const std::string&, const std::string&, std::chrono::milliseconds)
+		noexcept;
+
+		/// @see dealer::sendBatch
+		template<payloadRange range_t>
+		std::size_t
+		sendBatch(const std::string& name, const range_t& payloads) noexcept {
+			return local().sendBatch(name, payloads);
+		}
+
+		/// @see dealer::flush
+		std::size_t
+		flush(const std::string&) noexcept;
+
+		/// @see dealer::receive
+		std::optional<std::string>
+		receive(const std::string&, std::chrono::milliseconds) noexcept;
+
+		/// @see dealer::request
+		std::optional<std::string>
+		request(
+				const std::string&,
+				const std::string&,
+				std::chrono::milliseconds) noexcept;
+
+		/// @see dealer::stream
+		bool
+		stream(
+				const std::string& name,
+				std::string_view payload,
+				streamOptions options = {}) noexcept;
+
+		/// @see dealer::streamFile
+		bool
+		streamFile(
+				const std::string& name,
+				const std::string& path,
+				streamOptions options = {}) noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_SHARED_DEALER_H
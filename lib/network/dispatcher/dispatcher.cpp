@@ -0,0 +1,146 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:38
+//
+
+#include <lib/network/dispatcher/dispatcher.h>
+#include <lib/network/log/logger.h>
+#include <lib/network/numa/numaNode.h>
+
+namespace agoNetwork {
+	dispatcher::
+	dispatcher(unsigned int lanes, std::vector<unsigned int> cpus) noexcept {
+		for (unsigned int index{ 0 }; index<std::max(lanes, 1u); ++index) {
+			_lanes.push_back(std::make_unique<lane>());
+		}
+		for (auto& _lane : _lanes) {
+			_lane->worker = std::thread{ [&_lane = *_lane, cpus] {
+				if (not cpus.empty() && not numaNode::pin(cpus)) {
+					logger::warning("Error in pinning a dispatcher lane");
+				}
+				run_(_lane);
+			}};
+		}
+	}
+
+	dispatcher::
+	~dispatcher() {
+		for (auto& _lane : _lanes) {
+			{
+				std::lock_guard lock{ _lane->mutex };
+				_lane->stopping = true;
+			}
+			_lane->ready.notify_one();
+		}
+		for (auto& _lane : _lanes) {
+			if (_lane->worker.joinable()) {
+				_lane->worker.join();
+			}
+		}
+	}
+
+	void dispatcher::
+	run_(lane& _lane) noexcept {
+		while (true) {
+			task _task;
+			{
+				std::unique_lock lock{ _lane.mutex };
+				_lane.ready.wait(lock, [&] {
+					return _lane.stopping || not _lane.tasks.empty();
+				});
+				if (_lane.tasks.empty()) {
+					return;
+				}
+				_task = std::move(_lane.tasks.front()._task);
+				_lane.tasks.pop_front();
+			}
+			try {
+				_task();
+			}
+			catch (const std::exception& error) {
+				logger::error("Error in a dispatcher task, what? {}", error.what());
+			}
+			catch (...) {
+				logger::error("Unknown error in a dispatcher task");
+			}
+		}
+	}
+
+	void dispatcher::
+	dispatch(const std::string& key, task&& _task, const std::string& group)
+	noexcept {
+		auto& _lane = *_lanes[std::hash<std::string>{}(key)%_lanes.size()];
+		{
+			std::lock_guard lock{ _lane.mutex };
+			_lane.tasks.push_back({ _sequence++, key, group, std::move(_task) });
+		}
+		_lane.ready.notify_one();
+	}
+
+	bool dispatcher::
+	evictOldest(const std::string& group) noexcept {
+		const auto matches = [&group](const entry& _entry) {
+			return group.empty() || _entry.group==group;
+		};
+		// tasks of a lane are queued in order, so the first match of each lane
+		// is the oldest one of that lane.
+		lane* oldestLane{ nullptr };
+		std::uint64_t oldest{ 0 };
+		for (auto& _lane : _lanes) {
+			std::lock_guard lock{ _lane->mutex };
+			const auto candidate = std::find_if(
+					_lane->tasks.begin(), _lane->tasks.end(), matches);
+			if (candidate!=_lane->tasks.end()
+					&& (not oldestLane || candidate->sequence<oldest)) {
+				oldestLane = _lane.get();
+				oldest = candidate->sequence;
+			}
+		}
+		if (not oldestLane) {
+			return false;
+		}
+		task evicted;
+		{
+			std::lock_guard lock{ oldestLane->mutex };
+			const auto candidate = std::find_if(
+					oldestLane->tasks.begin(), oldestLane->tasks.end(),
+					[oldest](const entry& _entry) {
+						return _entry.sequence==oldest;
+					});
+			if (candidate==oldestLane->tasks.end()) {
+				// it is already running
+				return false;
+			}
+			evicted = std::move(candidate->_task);
+			oldestLane->tasks.erase(candidate);
+		}
+		return true;
+	}
+
+	std::size_t dispatcher::
+	evict(const std::string& key, const std::string& group) noexcept {
+		auto& _lane = *_lanes[std::hash<std::string>{}(key)%_lanes.size()];
+		// the evicted tasks are destroyed once the lane is unlocked
+		std::vector<task> evicted;
+		{
+			std::lock_guard lock{ _lane.mutex };
+			const auto kept = std::stable_partition(
+					_lane.tasks.begin(), _lane.tasks.end(),
+					[&](const entry& _entry) {
+						return _entry.key!=key
+								|| (not group.empty() && _entry.group!=group);
+					});
+			for (auto _entry = kept; _entry!=_lane.tasks.end(); ++_entry) {
+				evicted.push_back(std::move(_entry->_task));
+			}
+			_lane.tasks.erase(kept, _lane.tasks.end());
+		}
+		return evicted.size();
+	}
+
+	std::size_t dispatcher::
+	lanes() const noexcept {
+		return _lanes.size();
+	}
+}
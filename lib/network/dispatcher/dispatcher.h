@@ -0,0 +1,97 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:38
+//
+
+#ifndef AGO_NETWORK_DISPATCHER_H
+#define AGO_NETWORK_DISPATCHER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief **dispatcher** runs tasks on a fixed number of worker lanes.
+	/// Tasks are assigned to the lanes by hashing their key, so tasks of the
+	/// same key (e.g. the same client identity) run strictly in order,
+	/// while tasks of different keys run in parallel.
+	class dispatcher final {
+	private: // private data
+		/// task is a function alias which is run by a lane.
+		using task = std::function<void()>;
+		/// @brief A queued task, its key, its group and its order of arrival.
+		struct entry {
+			std::uint64_t sequence;
+			std::string key;
+			std::string group;
+			task _task;
+		};
+		/// @brief A worker thread and its queue of tasks.
+		struct lane {
+			std::mutex mutex;
+			std::condition_variable ready;
+			std::deque<entry> tasks;
+			bool stopping{ false };
+			std::thread worker;
+		};
+		/// The worker lanes.
+		std::vector<std::unique_ptr<lane>> _lanes;
+		/// Order of arrival of the next task.
+		std::atomic<std::uint64_t> _sequence{ 0 };
+
+	public: // constructors and destructors
+		/// @brief Spawn the worker lanes.
+		/// @param lanes Number of the worker lanes.
+		/// @param cpus CPUs which the worker lanes are pinned to, e.g. the
+		/// CPUs of a NUMA node, none means they are not pinned.
+		explicit
+		dispatcher(unsigned int lanes, std::vector<unsigned int> cpus = {}) noexcept;
+
+		/// @brief Run the queued tasks and join the worker lanes.
+		~dispatcher();
+
+	private: // private methods
+		/// @brief Run the tasks of a lane until it is stopped.
+		static void
+		run_(lane&) noexcept;
+
+	public: // public methods
+		/// @brief Queue a task on the lane of the specified key.
+		/// @param key picks the lane.
+		/// @param _task is the task.
+		/// @param group is used to find the task by dispatcher::evictOldest.
+		void
+		dispatch(const std::string& key, task&& _task,
+				const std::string& group = {}) noexcept;
+
+		/// @brief Remove the oldest queued (not running) task of a group.
+		/// The removed task is destroyed without being run.
+		/// @param group The group of the task, empty means any group.
+		/// @return true if a task is removed and false otherwise.
+		bool
+		evictOldest(const std::string& group) noexcept;
+
+		/// @brief Remove all the queued (not running) tasks of a key.
+		/// The removed tasks are destroyed without being run.
+		/// @param key The key of the tasks.
+		/// @param group The group of the tasks, empty means any group.
+		/// @return Number of the removed tasks.
+		std::size_t
+		evict(const std::string& key, const std::string& group) noexcept;
+
+		/// @brief Specify the number of the worker lanes.
+		[[nodiscard]]
+		std::size_t
+		lanes() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_DISPATCHER_H
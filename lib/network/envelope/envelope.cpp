@@ -0,0 +1,198 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:09
+//
+
+#include <lib/network/envelope/envelope.h>
+
+namespace agoNetwork {
+	namespace {
+		/// The first byte of a header frame.
+		constexpr char headerMagic{ '\xA6' };
+
+		/// Tags of the header fields.
+		enum class field : char {
+			budget = 1,
+			request = 2,
+			packed = 3,
+			compressed = 4,
+			stream = 5,
+			offset = 6,
+			total = 7,
+			credit = 8,
+		};
+
+		/// @brief Append a little endian integer field.
+		template<typename integer_t>
+		void
+		put(std::string& frame, field tag, integer_t value) noexcept {
+			frame.push_back(static_cast<char>(tag));
+			frame.push_back(static_cast<char>(sizeof(integer_t)));
+			for (std::size_t byte{ 0 }; byte<sizeof(integer_t); ++byte) {
+				frame.push_back(static_cast<char>((value >> (8*byte)) & 0xFF));
+			}
+		}
+
+		/// @brief Read a little endian integer field.
+		template<typename integer_t>
+		integer_t
+		get(const std::string& frame, std::size_t offset) noexcept {
+			integer_t value{ 0 };
+			for (std::size_t byte{ 0 }; byte<sizeof(integer_t); ++byte) {
+				value |= static_cast<integer_t>(
+						static_cast<unsigned char>(frame[offset+byte])) << (8*byte);
+			}
+			return value;
+		}
+	}
+
+	bool envelope::header::
+	empty() const noexcept {
+		return not budget && not request && not packed && not compressed
+				&& not stream && not offset && not total && not credit;
+	}
+
+	std::string envelope::
+	route(const std::vector<std::string>& frames) noexcept {
+		if (frames.size()==1) {
+			return frames.front();
+		}
+		std::string address(1, '\0');
+		address.push_back(static_cast<char>(frames.size()));
+		for (const auto& frame : frames) {
+			address.push_back(static_cast<char>(frame.size()));
+			address.append(frame);
+		}
+		return address;
+	}
+
+	std::vector<std::string> envelope::
+	hops(const std::string& address) noexcept {
+		if (address.size()<6 || address.front()!='\0') {
+			return { address };
+		}
+		std::vector<std::string> frames;
+		const auto count = static_cast<unsigned char>(address[1]);
+		std::size_t offset{ 2 };
+		for (unsigned int frame{ 0 };
+				frame<count && offset<address.size(); ++frame) {
+			const auto size = static_cast<unsigned char>(address[offset++]);
+			frames.push_back(address.substr(offset, size));
+			offset += size;
+		}
+		return frames;
+	}
+
+	std::string envelope::
+	encode(const header& _header) noexcept {
+		if (_header.empty()) {
+			return {};
+		}
+		std::string frame{ headerMagic, static_cast<char>(version) };
+		if (_header.budget) {
+			put(frame, field::budget, *_header.budget);
+		}
+		if (_header.request) {
+			put(frame, field::request, *_header.request);
+		}
+		if (_header.packed) {
+			put(frame, field::packed, *_header.packed);
+		}
+		if (_header.compressed) {
+			put(frame, field::compressed, *_header.compressed);
+		}
+		if (_header.stream) {
+			put(frame, field::stream, *_header.stream);
+		}
+		if (_header.offset) {
+			put(frame, field::offset, *_header.offset);
+		}
+		if (_header.total) {
+			put(frame, field::total, *_header.total);
+		}
+		if (_header.credit) {
+			put(frame, field::credit, *_header.credit);
+		}
+		return frame;
+	}
+
+	void envelope::
+	pack(std::string& frame, std::string_view message) noexcept {
+		auto size = message.size();
+		while (size>=0x80) {
+			frame.push_back(static_cast<char>((size & 0x7F) | 0x80));
+			size >>= 7;
+		}
+		frame.push_back(static_cast<char>(size));
+		frame.append(message);
+	}
+
+	std::vector<std::string> envelope::
+	unpack(const std::string& frame) noexcept {
+		std::vector<std::string> messages;
+		std::size_t offset{ 0 };
+		while (offset<frame.size()) {
+			std::size_t size{ 0 };
+			unsigned int shift{ 0 };
+			while (offset<frame.size() && shift<64) {
+				const auto byte = static_cast<unsigned char>(frame[offset++]);
+				size |= static_cast<std::size_t>(byte & 0x7F) << shift;
+				shift += 7;
+				if (not (byte & 0x80)) {
+					break;
+				}
+			}
+			if (size>frame.size()-offset) {
+				break;
+			}
+			messages.emplace_back(frame, offset, size);
+			offset += size;
+		}
+		return messages;
+	}
+
+	std::optional<envelope::header> envelope::
+	decode(const std::string& frame) noexcept {
+		if (frame.size()<2 || frame.front()!=headerMagic
+				|| static_cast<std::uint8_t>(frame[1])!=version) {
+			return std::nullopt;
+		}
+		header _header;
+		std::size_t offset{ 2 };
+		while (offset+2<=frame.size()) {
+			const auto tag = static_cast<field>(frame[offset]);
+			const auto size = static_cast<unsigned char>(frame[offset+1]);
+			offset += 2;
+			if (offset+size>frame.size()) {
+				return std::nullopt;
+			}
+			if (tag==field::budget && size==sizeof(std::uint32_t)) {
+				_header.budget = get<std::uint32_t>(frame, offset);
+			}
+			else if (tag==field::request && size==sizeof(std::uint64_t)) {
+				_header.request = get<std::uint64_t>(frame, offset);
+			}
+			else if (tag==field::packed && size==sizeof(std::uint32_t)) {
+				_header.packed = get<std::uint32_t>(frame, offset);
+			}
+			else if (tag==field::compressed && size==sizeof(std::uint8_t)) {
+				_header.compressed = get<std::uint8_t>(frame, offset);
+			}
+			else if (tag==field::stream && size==sizeof(std::uint64_t)) {
+				_header.stream = get<std::uint64_t>(frame, offset);
+			}
+			else if (tag==field::offset && size==sizeof(std::uint64_t)) {
+				_header.offset = get<std::uint64_t>(frame, offset);
+			}
+			else if (tag==field::total && size==sizeof(std::uint64_t)) {
+				_header.total = get<std::uint64_t>(frame, offset);
+			}
+			else if (tag==field::credit && size==sizeof(std::uint32_t)) {
+				_header.credit = get<std::uint32_t>(frame, offset);
+			}
+			offset += size;
+		}
+		return _header;
+	}
+}
@@ -0,0 +1,104 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 09:10
+//
+
+#ifndef AGO_NETWORK_ENVELOPE_H
+#define AGO_NETWORK_ENVELOPE_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace agoNetwork::envelope {
+	/// Version of the header frame, the byte after its magic byte.
+	/// A header of another version is not decoded, so both ends of a
+	/// socket should be upgraded together once it changes.
+	inline constexpr std::uint8_t version{ 1 };
+
+	/// @brief Optional metadata of a request.
+	/// It travels as one frame between the empty delimiter and the message
+	/// (identity, delimiter, header, message), requests without metadata
+	/// carry no such frame at all.
+	/// @warning Peers which predate the header frame read a fixed number
+	/// of frames, so they take the header for the message and every later
+	/// receive of their socket is out of step. Any traffic which carries a
+	/// header breaks them: a deadline, dealer::request, packing,
+	/// compression (of either side, see dealer::compress and
+	/// router::compress) or streaming. The router replies with a header
+	/// only to the requests which carried one.
+	struct header {
+		/// Remaining time budget of the request in milliseconds.
+		std::optional<std::uint32_t> budget;
+		/// Identifies the request of a dealer, the router echoes it on the
+		/// replies so the dealer could match them to its requests.
+		std::optional<std::uint64_t> request;
+		/// Number of the messages packed into the message frame.
+		/// @see envelope::pack
+		std::optional<std::uint32_t> packed;
+		/// The compression flag of the message frame.
+		/// @see compressor
+		std::optional<std::uint8_t> compressed;
+		/// Identifies the stream of a chunk or of a credit.
+		/// @see dealer::stream
+		std::optional<std::uint64_t> stream;
+		/// Offset of a chunk in its payload.
+		std::optional<std::uint64_t> offset;
+		/// Size of the payload of a chunk.
+		std::optional<std::uint64_t> total;
+		/// Number of the chunks which the router grants its dealer to send.
+		std::optional<std::uint32_t> credit;
+
+		/// @brief Specify whether the header carries anything.
+		[[nodiscard]]
+		bool
+		empty() const noexcept;
+	};
+
+	/// @brief Pack the routing frames which precede the empty delimiter
+	/// into a single address.
+	/// A direct peer has one routing frame which is returned as is, so the
+	/// address stays the plain peer identity.
+	/// Each broker in between prepends one more frame, such envelopes are
+	/// packed as a zero byte, the number of frames and the length prefixed
+	/// frames. zmq never generates such an identity since its own
+	/// identities are exactly 5 bytes and user identities could not start
+	/// with a zero byte.
+	/// @return The packed address.
+	std::string
+	route(const std::vector<std::string>&) noexcept;
+
+	/// @brief Unpack an address made by envelope::route.
+	/// @return The routing frames which should precede the empty delimiter.
+	std::vector<std::string>
+	hops(const std::string&) noexcept;
+
+	/// @brief Encode a header as a magic byte and envelope::version
+	/// followed by tag, length and value fields.
+	/// @return The header frame or an empty string for an empty header.
+	std::string
+	encode(const header&) noexcept;
+
+	/// @brief Append a message to a packed frame as its length (a base 128
+	/// varint) followed by its bytes.
+	void
+	pack(std::string&, std::string_view) noexcept;
+
+	/// @brief Split a packed frame made by envelope::pack.
+	/// A truncated trailing message is dropped.
+	/// @return The packed messages.
+	std::vector<std::string>
+	unpack(const std::string&) noexcept;
+
+	/// @brief Decode a header frame made by envelope::encode.
+	/// Unknown fields are skipped.
+	/// @return The header or nothing if the frame is not a header or it is
+	/// of another version.
+	std::optional<header>
+	decode(const std::string&) noexcept;
+}
+
+#endif //AGO_NETWORK_ENVELOPE_H
@@ -0,0 +1,80 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:43
+//
+
+#include <algorithm>
+#include <lib/network/hedger/hedger.h>
+
+namespace agoNetwork {
+	namespace {
+		/// Number of the recent round trip times which are kept.
+		constexpr std::size_t window{ 256 };
+		/// Requests are not hedged before this many round trip times
+		/// are observed.
+		constexpr std::size_t warmup{ 16 };
+		/// The budget never saves more hedges than this for a burst.
+		constexpr double maxTokens{ 10 };
+	}
+
+	hedger::
+	hedger(double percentile, double budget) noexcept
+			:_percentile{ std::clamp(percentile, 0.0, 1.0) },
+			 _budget{ std::max(budget, 0.0) } {
+		_samples.reserve(window);
+	}
+
+	void hedger::
+	observe(std::chrono::microseconds rtt) noexcept {
+		std::lock_guard lock{ _mutex };
+		if (_samples.size()<window) {
+			_samples.push_back(rtt);
+		}
+		else {
+			_samples[_next] = rtt;
+			_next = (_next+1)%window;
+		}
+	}
+
+	std::optional<std::chrono::microseconds> hedger::
+	request() noexcept {
+		std::lock_guard lock{ _mutex };
+		++_statistics.requests;
+		_tokens = std::min(_tokens+_budget, maxTokens);
+		if (_samples.size()<warmup) {
+			_statistics.delay = std::chrono::microseconds{ 0 };
+			return std::nullopt;
+		}
+		auto samples = _samples;
+		const auto rank = static_cast<std::size_t>(
+				_percentile*static_cast<double>(samples.size()-1));
+		std::nth_element(samples.begin(), samples.begin()+rank, samples.end());
+		_statistics.delay = samples[rank];
+		return _statistics.delay;
+	}
+
+	bool hedger::
+	acquire() noexcept {
+		std::lock_guard lock{ _mutex };
+		if (_tokens<1) {
+			++_statistics.denied;
+			return false;
+		}
+		_tokens -= 1;
+		++_statistics.hedges;
+		return true;
+	}
+
+	void hedger::
+	won() noexcept {
+		std::lock_guard lock{ _mutex };
+		++_statistics.wins;
+	}
+
+	hedger::statistics hedger::
+	stats() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return _statistics;
+	}
+}
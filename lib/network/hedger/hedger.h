@@ -0,0 +1,84 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:43
+//
+
+#ifndef AGO_NETWORK_HEDGER_H
+#define AGO_NETWORK_HEDGER_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief **hedger** decides when a request deserves a duplicate on
+	/// another endpoint.
+	/// The hedge delay is a percentile of the recent round trip times, so
+	/// only the slowest requests are hedged, and the hedges are paid from a
+	/// budget which each request adds a fraction of a hedge to.
+	class hedger final {
+	public: // public data
+		/// @brief What the hedger did so far.
+		struct statistics {
+			std::uint64_t requests{ 0 };
+			/// Number of the duplicates sent.
+			std::uint64_t hedges{ 0 };
+			/// Number of the duplicates replied before their original.
+			std::uint64_t wins{ 0 };
+			/// Number of the hedges which are not sent for lack of budget.
+			std::uint64_t denied{ 0 };
+			/// The current hedge delay, zero means not enough is observed.
+			std::chrono::microseconds delay{ 0 };
+		};
+
+	private: // private data
+		/// The percentile of the round trip times which is the hedge delay.
+		double _percentile;
+		/// The fraction of a hedge which each request adds to the budget.
+		double _budget;
+		/// The hedges which could be sent right now.
+		double _tokens{ 1 };
+		/// The recent round trip times, used as a ring.
+		std::vector<std::chrono::microseconds> _samples;
+		/// The next sample to overwrite once the ring is full.
+		std::size_t _next{ 0 };
+		statistics _statistics;
+		mutable std::mutex _mutex;
+
+	public: // constructors and destructors
+		/// @param percentile e.g. 0.95 hedges the requests slower than 95%
+		/// of the recent ones.
+		/// @param budget e.g. 0.05 allows one hedge per 20 requests.
+		hedger(double percentile, double budget) noexcept;
+
+	public: // public methods
+		/// @brief Record the round trip time of a reply.
+		void
+		observe(std::chrono::microseconds) noexcept;
+
+		/// @brief Count a request and add its share to the budget.
+		/// @return The hedge delay of the request or nothing if too few
+		/// round trip times are observed to hedge at all.
+		std::optional<std::chrono::microseconds>
+		request() noexcept;
+
+		/// @brief Pay a hedge from the budget.
+		/// @return true if the hedge could be sent and false otherwise.
+		bool
+		acquire() noexcept;
+
+		/// @brief Count a hedge replied before its original request.
+		void
+		won() noexcept;
+
+		/// @brief Specify what the hedger did so far.
+		[[nodiscard]]
+		statistics
+		stats() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_HEDGER_H
@@ -0,0 +1,86 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:46
+//
+
+#include <algorithm>
+#include <lib/network/limiter/concurrencyLimit.h>
+
+namespace agoNetwork {
+	concurrencyLimit::
+	concurrencyLimit(limitOptions _options) noexcept
+			:_options{ _options },
+			 _limit{ static_cast<double>(std::clamp(
+					 _options.initial,
+					 std::max<std::size_t>(_options.minimum, 1),
+					 std::max(_options.maximum, _options.minimum))) } { }
+
+	void concurrencyLimit::
+	backoff_() noexcept {
+		_limit = std::max(
+				_limit*_options.backoff,
+				static_cast<double>(std::max<std::size_t>(_options.minimum, 1)));
+	}
+
+	bool concurrencyLimit::
+	acquire() noexcept {
+		std::lock_guard lock{ _mutex };
+		if (static_cast<double>(_inflight)+1>_limit) {
+			++_rejected;
+			return false;
+		}
+		++_inflight;
+		return true;
+	}
+
+	void concurrencyLimit::
+	cancel() noexcept {
+		std::lock_guard lock{ _mutex };
+		if (_inflight>0) {
+			--_inflight;
+		}
+	}
+
+	void concurrencyLimit::
+	release(std::optional<std::chrono::microseconds> rtt) noexcept {
+		std::lock_guard lock{ _mutex };
+		// the limit only grows while it is actually used
+		const auto utilized = static_cast<double>(_inflight)*2>=_limit;
+		if (_inflight>0) {
+			--_inflight;
+		}
+		if (not rtt) {
+			backoff_();
+			return;
+		}
+		if (_minRtt.count()==0 || *rtt<_minRtt) {
+			_minRtt = std::max(*rtt, std::chrono::microseconds{ 1 });
+		}
+		else {
+			// creep towards the observed round trips, so a lasting change
+			// of the endpoint (e.g. it moved further away) is learned
+			_minRtt += (*rtt-_minRtt)/1024;
+		}
+		if (static_cast<double>(rtt->count())
+				>_options.tolerance*static_cast<double>(_minRtt.count())) {
+			backoff_();
+		}
+		else if (utilized) {
+			_limit = std::min(
+					_limit+1/_limit,
+					static_cast<double>(_options.maximum));
+		}
+	}
+
+	concurrencyLimit::statistics concurrencyLimit::
+	stats() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return {
+				static_cast<std::size_t>(_limit),
+				_inflight,
+				_rejected,
+				_minRtt
+		};
+	}
+}
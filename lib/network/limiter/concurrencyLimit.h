@@ -0,0 +1,87 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:46
+//
+
+#ifndef AGO_NETWORK_CONCURRENCY_LIMIT_H
+#define AGO_NETWORK_CONCURRENCY_LIMIT_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace agoNetwork {
+	/// @brief Options of an adaptive concurrency limit.
+	struct limitOptions {
+		std::size_t initial{ 20 };
+		std::size_t minimum{ 1 };
+		std::size_t maximum{ 1000 };
+		/// The limit is multiplied by this on a failure or a congestion.
+		double backoff{ 0.9 };
+		/// A round trip longer than this times the shortest one observed
+		/// means the endpoint is congested.
+		double tolerance{ 2.0 };
+	};
+
+	/// @brief **concurrencyLimit** bounds the requests of an endpoint which
+	/// wait for their reply by a limit learned from the round trip times
+	/// (additive increase, multiplicative decrease).
+	/// The limit grows by one per limit replies while the endpoint keeps up
+	/// and shrinks by the backoff once it fails or slows down.
+	class concurrencyLimit final {
+	public: // public data
+		/// @brief What the limit did so far.
+		struct statistics {
+			std::size_t limit{ 0 };
+			std::size_t inflight{ 0 };
+			/// Number of the requests beyond the limit.
+			std::uint64_t rejected{ 0 };
+			/// The shortest round trip time observed, slowly aged.
+			std::chrono::microseconds minRtt{ 0 };
+		};
+
+	private: // private data
+		limitOptions _options;
+		double _limit;
+		std::size_t _inflight{ 0 };
+		std::uint64_t _rejected{ 0 };
+		std::chrono::microseconds _minRtt{ 0 };
+		mutable std::mutex _mutex;
+
+	public: // constructors and destructors
+		explicit
+		concurrencyLimit(limitOptions _options = {}) noexcept;
+
+	private: // private methods
+		/// @brief Shrink the limit by the backoff.
+		void
+		backoff_() noexcept;
+
+	public: // public methods
+		/// @brief Take a slot for a request.
+		/// @return true if the request is within the limit and false
+		/// otherwise.
+		bool
+		acquire() noexcept;
+
+		/// @brief Give back a slot without judging the endpoint,
+		/// e.g. the request is not sent after all.
+		void
+		cancel() noexcept;
+
+		/// @brief Give back the slot of a finished request.
+		/// @param rtt The round trip time of the reply or nothing if the
+		/// request failed.
+		void
+		release(std::optional<std::chrono::microseconds> rtt) noexcept;
+
+		/// @brief Specify what the limit did so far.
+		[[nodiscard]]
+		statistics
+		stats() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_CONCURRENCY_LIMIT_H
@@ -0,0 +1,380 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:23
+//
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <lib/network/log/logger.h>
+
+namespace agoNetwork {
+	namespace {
+		using clock = std::chrono::steady_clock;
+
+		/// @brief A record which is not formatted yet.
+		struct record {
+			logLevel level{ logLevel::off };
+			std::uint8_t count{ 0 };
+			/// Number of the records of the same call site which are
+			/// suppressed right before this one.
+			std::uint32_t suppressed{ 0 };
+			std::chrono::system_clock::time_point time;
+			const char* format{ nullptr };
+			logger::argument arguments[logger::maxArguments];
+		};
+
+		/// @brief The records of a thread, written by the thread alone and
+		/// read by the background thread alone.
+		struct ring {
+			static constexpr std::size_t capacity{ 128 };
+			std::array<record, capacity> records;
+			alignas(64) std::atomic<std::size_t> head{ 0 };
+			alignas(64) std::atomic<std::size_t> tail{ 0 };
+
+			/// @brief The rate of a call site, used by the thread alone.
+			struct site {
+				const char* format{ nullptr };
+				clock::time_point window;
+				std::uint32_t count{ 0 };
+				std::uint32_t suppressed{ 0 };
+			};
+			std::array<site, 16> sites;
+		};
+
+		std::atomic<logLevel> currentLevel{ logLevel::warning };
+		std::atomic<std::uint32_t> currentRate{ 10 };
+		std::atomic<std::uint64_t> written{ 0 };
+		std::atomic<std::uint64_t> dropped{ 0 };
+		std::atomic<std::uint64_t> suppressed{ 0 };
+
+		/// @brief Formats and writes out the records of all the threads.
+		class backend final {
+		private:
+			std::mutex _mutex;
+			std::condition_variable _ready;
+			std::vector<std::shared_ptr<ring>> _rings;
+			logger::sink _sink;
+			bool _stopping{ false };
+			std::thread _thread;
+
+			static std::string_view
+			name(logLevel level) noexcept {
+				switch (level) {
+				case logLevel::trace: {
+					return "trace";
+				}
+				case logLevel::debug: {
+					return "debug";
+				}
+				case logLevel::info: {
+					return "info";
+				}
+				case logLevel::warning: {
+					return "warning";
+				}
+				default: {
+					return "error";
+				}
+				}
+			}
+
+			static void
+			format(std::string& line, const record& _record) {
+				line.clear();
+				const auto seconds = std::chrono::system_clock::to_time_t(_record.time);
+				const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+						_record.time.time_since_epoch()).count()%1000;
+				std::tm local{};
+				::localtime_r(&seconds, &local);
+				char stamp[32];
+				const auto size = std::strftime(stamp, sizeof(stamp), "%F %T", &local);
+				std::snprintf(stamp+size, sizeof(stamp)-size, ".%03d",
+						static_cast<int>(milliseconds));
+				line.append(stamp).append(" [").append(name(_record.level)).append("] ");
+				std::size_t next{ 0 };
+				for (const auto* character = _record.format; *character; ++character) {
+					if (character[0]=='{' && character[1]=='}' && next<_record.count) {
+						_record.arguments[next++].format(line);
+						++character;
+						continue;
+					}
+					line.push_back(*character);
+				}
+				if (_record.suppressed>0) {
+					line.append(" (")
+							.append(std::to_string(_record.suppressed))
+							.append(" similar records suppressed)");
+				}
+			}
+
+			/// @brief Write out the records of the rings.
+			/// @return Number of the written records.
+			std::size_t
+			drain(const std::vector<std::shared_ptr<ring>>& rings, const logger::sink& _sink_,
+					std::string& line) noexcept {
+				std::size_t count{ 0 };
+				for (const auto& _ring : rings) {
+					auto tail = _ring->tail.load(std::memory_order_relaxed);
+					const auto head = _ring->head.load(std::memory_order_acquire);
+					for (; tail!=head; ++tail, ++count) {
+						const auto& _record = _ring->records[tail%ring::capacity];
+						try {
+							format(line, _record);
+							if (_sink_) {
+								_sink_(_record.level, line);
+							}
+							else {
+								line.push_back('\n');
+								std::fwrite(line.data(), 1, line.size(), stderr);
+							}
+						}
+						catch (...) { }
+						_ring->tail.store(tail+1, std::memory_order_release);
+					}
+				}
+				written.fetch_add(count, std::memory_order_relaxed);
+				return count;
+			}
+
+			void
+			run() noexcept {
+				std::vector<std::shared_ptr<ring>> rings;
+				logger::sink _sink_;
+				std::string line;
+				for (;;) {
+					bool stopping;
+					{
+						std::lock_guard lock{ _mutex };
+						// the rings of the exited threads go once they are empty
+						std::erase_if(_rings, [](const auto& _ring) {
+							return _ring.use_count()==1
+									&& _ring->tail.load()==_ring->head.load();
+						});
+						rings = _rings;
+						_sink_ = _sink;
+						stopping = _stopping;
+					}
+					if (drain(rings, _sink_, line)>0) {
+						continue;
+					}
+					if (stopping) {
+						std::fflush(stderr);
+						return;
+					}
+					std::fflush(stderr);
+					std::unique_lock lock{ _mutex };
+					// the threads never notify, so they never wait for the lock
+					_ready.wait_for(lock, std::chrono::milliseconds{ 10 });
+				}
+			}
+
+		public:
+			backend() noexcept
+					:_thread{ [this] { run(); }} {}
+
+			~backend() {
+				{
+					std::lock_guard lock{ _mutex };
+					_stopping = true;
+				}
+				_ready.notify_one();
+				_thread.join();
+			}
+
+			std::shared_ptr<ring>
+			attach() noexcept {
+				try {
+					auto _ring = std::make_shared<ring>();
+					std::lock_guard lock{ _mutex };
+					_rings.push_back(_ring);
+					return _ring;
+				}
+				catch (...) {
+					return nullptr;
+				}
+			}
+
+			void
+			output(logger::sink sink_) noexcept {
+				std::lock_guard lock{ _mutex };
+				_sink = std::move(sink_);
+			}
+
+			bool
+			pending() noexcept {
+				std::lock_guard lock{ _mutex };
+				return std::any_of(_rings.begin(), _rings.end(), [](const auto& _ring) {
+					return _ring->tail.load()!=_ring->head.load();
+				});
+			}
+
+			void
+			wake() noexcept {
+				_ready.notify_one();
+			}
+		};
+
+		backend&
+		instance() noexcept {
+			static backend _backend;
+			return _backend;
+		}
+
+		/// The ring of each thread.
+		thread_local std::shared_ptr<ring> currentRing;
+
+		/// @brief Specify whether the rate limit of a call site lets a record
+		/// through, the records suppressed before it are counted into it.
+		bool
+		admit(ring& _ring, const char* format, std::uint32_t& suppressedBefore) noexcept {
+			const auto rate = currentRate.load(std::memory_order_relaxed);
+			if (rate==0) {
+				return true;
+			}
+			const auto now = clock::now();
+			auto* _site = &_ring.sites.front();
+			for (auto& site : _ring.sites) {
+				if (site.format==format) {
+					_site = &site;
+					break;
+				}
+				// the least recent site makes room for a new one
+				if (site.window<_site->window) {
+					_site = &site;
+				}
+			}
+			if (_site->format!=format || now-_site->window>=std::chrono::seconds{ 1 }) {
+				suppressedBefore = _site->format==format ? _site->suppressed : 0;
+				*_site = { format, now, 1, 0 };
+				return true;
+			}
+			if (_site->count>=rate) {
+				++_site->suppressed;
+				suppressed.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			++_site->count;
+			suppressedBefore = std::exchange(_site->suppressed, 0);
+			return true;
+		}
+	}
+
+	logger::argument::
+	argument(std::string_view value) noexcept
+			:_kind{ kind::text },
+			 _size{ static_cast<std::uint8_t>(std::min(value.size(), maxText)) } {
+		std::memcpy(_text, value.data(), _size);
+	}
+
+	void logger::argument::
+	format(std::string& line) const {
+		switch (_kind) {
+		case kind::signedInteger: {
+			line.append(std::to_string(_signed));
+			break;
+		}
+		case kind::unsignedInteger: {
+			line.append(std::to_string(_unsigned));
+			break;
+		}
+		case kind::real: {
+			line.append(std::to_string(_real));
+			break;
+		}
+		case kind::text: {
+			line.append(_text, _size);
+			break;
+		}
+		}
+	}
+
+	void logger::
+	write_(
+			logLevel level,
+			const char* format,
+			const argument* arguments,
+			std::size_t count) noexcept {
+		if (not currentRing) {
+			currentRing = instance().attach();
+			if (not currentRing) {
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		auto& _ring = *currentRing;
+		std::uint32_t suppressedBefore{ 0 };
+		if (not admit(_ring, format, suppressedBefore)) {
+			return;
+		}
+		const auto head = _ring.head.load(std::memory_order_relaxed);
+		if (head-_ring.tail.load(std::memory_order_acquire)>=ring::capacity) {
+			// never wait for the background thread
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		auto& _record = _ring.records[head%ring::capacity];
+		_record.level = level;
+		_record.count = static_cast<std::uint8_t>(count);
+		_record.suppressed = suppressedBefore;
+		_record.time = std::chrono::system_clock::now();
+		_record.format = format;
+		std::copy_n(arguments, count, _record.arguments);
+		_ring.head.store(head+1, std::memory_order_release);
+	}
+
+	void logger::
+	level(logLevel level) noexcept {
+		currentLevel.store(level, std::memory_order_relaxed);
+	}
+
+	logLevel logger::
+	level() noexcept {
+		return currentLevel.load(std::memory_order_relaxed);
+	}
+
+	bool logger::
+	enabled(logLevel level) noexcept {
+		return level!=logLevel::off
+				&& level>=currentLevel.load(std::memory_order_relaxed);
+	}
+
+	void logger::
+	rateLimit(std::uint32_t perSecond) noexcept {
+		currentRate.store(perSecond, std::memory_order_relaxed);
+	}
+
+	void logger::
+	output(sink sink_) noexcept {
+		instance().output(std::move(sink_));
+	}
+
+	void logger::
+	flush() noexcept {
+		auto& _backend = instance();
+		const auto until = clock::now()+std::chrono::seconds{ 1 };
+		while (_backend.pending() && clock::now()<until) {
+			_backend.wake();
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+		}
+	}
+
+	logger::statistics logger::
+	stats() noexcept {
+		return {
+				written.load(std::memory_order_relaxed),
+				dropped.load(std::memory_order_relaxed),
+				suppressed.load(std::memory_order_relaxed) };
+	}
+}
@@ -0,0 +1,200 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:23
+//
+
+#ifndef AGO_NETWORK_LOGGER_H
+#define AGO_NETWORK_LOGGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace agoNetwork {
+	/// @brief Represents log levels.
+	enum class logLevel : std::uint8_t {
+		trace,
+		debug,
+		info,
+		warning,
+		error,
+		/// Nothing is logged.
+		off,
+	};
+
+	/// @brief **logger** logs the errors and diagnostics of the library
+	/// without blocking the calling thread.
+	/// Each thread writes its records into a lock free ring of its own and
+	/// a background thread formats and writes them out, so a poll loop
+	/// never waits for the output. A full ring drops the record, and the
+	/// records of a call site beyond the rate limit are suppressed and
+	/// counted on the next record of the site.
+	class logger final {
+	public: // public data
+		/// Maximum number of the arguments of a record.
+		static constexpr std::size_t maxArguments{ 6 };
+		/// Longer text arguments are truncated.
+		static constexpr std::size_t maxText{ 54 };
+
+		/// @brief An argument of a record, copied into the record so it is
+		/// formatted later by the background thread.
+		class argument final {
+			friend class logger;
+
+		private:
+			enum class kind : std::uint8_t {
+				signedInteger,
+				unsignedInteger,
+				real,
+				text,
+			} _kind{ kind::text };
+			std::uint8_t _size{ 0 };
+			union {
+				std::int64_t _signed;
+				std::uint64_t _unsigned;
+				double _real;
+				char _text[maxText];
+			};
+
+		public:
+			argument() noexcept
+					:_signed{ 0 } {}
+
+			template<typename integer_t>
+			requires std::is_integral_v<integer_t>
+			argument(integer_t value) noexcept {
+				if constexpr (std::is_signed_v<integer_t>) {
+					_kind = kind::signedInteger;
+					_signed = value;
+				}
+				else {
+					_kind = kind::unsignedInteger;
+					_unsigned = value;
+				}
+			}
+
+			argument(double value) noexcept
+					:_kind{ kind::real },
+					 _real{ value } {}
+
+			argument(std::string_view) noexcept;
+
+			argument(const char* value) noexcept
+					:argument{ std::string_view{ value ? value : "" }} {}
+
+			argument(const std::string& value) noexcept
+					:argument{ std::string_view{ value }} {}
+
+			/// @brief Append the argument to a line.
+			void
+			format(std::string&) const;
+		};
+
+		/// @brief What the logger did so far.
+		struct statistics {
+			std::uint64_t written{ 0 };
+			/// Number of the records dropped since the ring of their thread
+			/// was full.
+			std::uint64_t dropped{ 0 };
+			/// Number of the records suppressed by the rate limit.
+			std::uint64_t suppressed{ 0 };
+		};
+
+		/// @brief sink is a function alias which gets the level and the
+		/// formatted line of each record, on the background thread.
+		using sink = std::function<void(logLevel, std::string_view)>;
+
+	private: // private methods
+		/// @brief Put a record into the ring of the calling thread.
+		static void
+		write_(logLevel, const char*, const argument*, std::size_t) noexcept;
+
+		template<typename... args_t>
+		static void
+		log_(logLevel level, const char* format, const args_t& ... args) noexcept {
+			static_assert(sizeof...(args_t)<=maxArguments,
+					"agoNetwork::logger takes at most maxArguments arguments");
+			if (not enabled(level)) {
+				return;
+			}
+			const argument arguments[sizeof...(args_t)+1]{ argument{ args }... };
+			write_(level, format, arguments, sizeof...(args_t));
+		}
+
+	public: // public methods
+		/// @brief Set the minimum level which is logged, warning by default.
+		static void
+		level(logLevel) noexcept;
+
+		/// @brief Specify the minimum level which is logged.
+		[[nodiscard]]
+		static logLevel
+		level() noexcept;
+
+		/// @brief Specify whether the records of a level are logged.
+		[[nodiscard]]
+		static bool
+		enabled(logLevel) noexcept;
+
+		/// @brief Set how many records each call site of each thread logs
+		/// per second, ten by default and zero means unlimited.
+		static void
+		rateLimit(std::uint32_t) noexcept;
+
+		/// @brief Set where the formatted records go, the standard error by
+		/// default.
+		static void
+		output(sink) noexcept;
+
+		/// @brief Wait (for at most a second) until the records written so
+		/// far are written out.
+		/// @note It blocks, so it should not be called by a poll loop.
+		static void
+		flush() noexcept;
+
+		/// @brief Specify what the logger did so far.
+		[[nodiscard]]
+		static statistics
+		stats() noexcept;
+
+		/// @brief Log a record, each {} of the format is replaced by the next
+		/// argument once the record is formatted.
+		/// @note The format should be a string literal, it is kept by its
+		/// address until the record is formatted.
+		template<typename... args_t>
+		static void
+		trace(const char* format, const args_t& ... args) noexcept {
+			log_(logLevel::trace, format, args...);
+		}
+
+		template<typename... args_t>
+		static void
+		debug(const char* format, const args_t& ... args) noexcept {
+			log_(logLevel::debug, format, args...);
+		}
+
+		template<typename... args_t>
+		static void
+		info(const char* format, const args_t& ... args) noexcept {
+			log_(logLevel::info, format, args...);
+		}
+
+		template<typename... args_t>
+		static void
+		warning(const char* format, const args_t& ... args) noexcept {
+			log_(logLevel::warning, format, args...);
+		}
+
+		template<typename... args_t>
+		static void
+		error(const char* format, const args_t& ... args) noexcept {
+			log_(logLevel::error, format, args...);
+		}
+	};
+}
+
+#endif //AGO_NETWORK_LOGGER_H
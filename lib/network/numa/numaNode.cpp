@@ -0,0 +1,190 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 09:30
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <zmq.hpp>
+#include <lib/network/numa/numaNode.h>
+#include <lib/network/log/logger.h>
+#ifdef AGO_NETWORK_WITH_NUMA
+#include <numa.h>
+#endif
+
+namespace agoNetwork {
+	namespace {
+		/// Binds the pages to the nodes of the mask (see mbind(2)).
+		constexpr int bindPolicy{ 2 };
+		/// Moves the pages which are already touched (see mbind(2)).
+		constexpr unsigned int movePages{ 1u << 1 };
+
+		/// @brief Parse a CPU list of /sys, e.g. 0-3,8-11.
+		std::vector<unsigned int>
+		parse(const std::string& list) {
+			std::vector<unsigned int> cpus;
+			std::size_t position{ 0 };
+			while (position<list.size()) {
+				auto end = list.find(',', position);
+				if (end==std::string::npos) {
+					end = list.size();
+				}
+				const auto range = list.substr(position, end-position);
+				position = end+1;
+				if (range.empty()) {
+					continue;
+				}
+				const auto dash = range.find('-');
+				const auto first = static_cast<unsigned int>(std::stoul(range.substr(0, dash)));
+				const auto last = dash==std::string::npos
+						? first
+						: static_cast<unsigned int>(std::stoul(range.substr(dash+1)));
+				for (auto cpu = first; cpu<=last; ++cpu) {
+					cpus.push_back(cpu);
+				}
+			}
+			return cpus;
+		}
+	}
+
+	numaNode::
+	numaNode(unsigned int id) noexcept
+			:_id{ id } {}
+
+	unsigned int numaNode::
+	count() noexcept {
+#ifdef AGO_NETWORK_WITH_NUMA
+		if (::numa_available()>=0) {
+			return static_cast<unsigned int>(::numa_num_configured_nodes());
+		}
+#endif
+		unsigned int nodes{ 0 };
+		while (std::ifstream{ "/sys/devices/system/node/node"+std::to_string(nodes)+"/cpulist" }) {
+			++nodes;
+		}
+		return std::max(nodes, 1u);
+	}
+
+	std::optional<numaNode> numaNode::
+	of(const std::string& interface) noexcept {
+		std::ifstream file{ "/sys/class/net/"+interface+"/device/numa_node" };
+		int node{ -1 };
+		// virtual interfaces have no device and -1 means no locality
+		if (not (file >> node) || node<0) {
+			return std::nullopt;
+		}
+		return numaNode{ static_cast<unsigned int>(node) };
+	}
+
+	bool numaNode::
+	pin(const std::vector<unsigned int>& cpus) noexcept {
+		if (cpus.empty()) {
+			return false;
+		}
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for (const auto cpu : cpus) {
+			if (cpu<CPU_SETSIZE) {
+				CPU_SET(cpu, &set);
+			}
+		}
+		return ::sched_setaffinity(0, sizeof(set), &set)==0;
+	}
+
+	unsigned int numaNode::
+	id() const noexcept {
+		return _id;
+	}
+
+	std::vector<unsigned int> numaNode::
+	cpus() const noexcept {
+		try {
+#ifdef AGO_NETWORK_WITH_NUMA
+			if (::numa_available()>=0) {
+				std::vector<unsigned int> cpus;
+				auto* mask = ::numa_allocate_cpumask();
+				if (::numa_node_to_cpus(static_cast<int>(_id), mask)==0) {
+					for (unsigned int cpu{ 0 }; cpu<mask->size; ++cpu) {
+						if (::numa_bitmask_isbitset(mask, cpu)) {
+							cpus.push_back(cpu);
+						}
+					}
+				}
+				::numa_free_cpumask(mask);
+				return cpus;
+			}
+#endif
+			std::ifstream file{ "/sys/devices/system/node/node"+std::to_string(_id)+"/cpulist" };
+			std::string list;
+			if (file >> list) {
+				return parse(list);
+			}
+			if (_id==0) {
+				// a host without NUMA is a single node of all the CPUs
+				std::vector<unsigned int> cpus(std::max(::sysconf(_SC_NPROCESSORS_ONLN), 1l));
+				for (unsigned int cpu{ 0 }; cpu<cpus.size(); ++cpu) {
+					cpus[cpu] = cpu;
+				}
+				return cpus;
+			}
+		}
+		catch (const std::exception& error) {
+			logger::error("Error in reading the CPUs of numa node {}, what? {}", _id, error.what());
+		}
+		return {};
+	}
+
+	bool numaNode::
+	pin() const noexcept {
+		return pin(cpus());
+	}
+
+	bool numaNode::
+	bind(void* data, std::size_t size) const noexcept {
+		if (data==nullptr || size==0) {
+			return false;
+		}
+		// memory is bound by whole pages
+		const auto page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+		const auto begin = reinterpret_cast<std::uintptr_t>(data) & ~(page-1);
+		const auto end = reinterpret_cast<std::uintptr_t>(data)+size;
+#ifdef AGO_NETWORK_WITH_NUMA
+		if (::numa_available()>=0) {
+			::numa_tonode_memory(reinterpret_cast<void*>(begin), end-begin, static_cast<int>(_id));
+			return true;
+		}
+#endif
+		// the kernel reads one bit less than the specified number of nodes
+		constexpr auto bits = 8*sizeof(unsigned long);
+		if (_id>=bits-1) {
+			return false;
+		}
+		const unsigned long mask{ 1ul << _id };
+		return ::syscall(SYS_mbind, begin, end-begin, bindPolicy, &mask, bits, movePages)==0;
+	}
+
+	std::shared_ptr<zmq::context_t> numaNode::
+	context(unsigned int ioThreads) const noexcept {
+		auto context = std::make_shared<zmq::context_t>(static_cast<int>(ioThreads));
+#ifdef ZMQ_THREAD_AFFINITY_CPU_ADD
+		// the IO threads start with the first socket, so it is not too late
+		try {
+			for (const auto cpu : cpus()) {
+				context->setctxopt(ZMQ_THREAD_AFFINITY_CPU_ADD, static_cast<int>(cpu));
+			}
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in pinning the IO threads to numa node {}, what? {}",
+					_id, error.what());
+		}
+#else
+		logger::warning("The zmq library could not pin the IO threads to numa node {}", _id);
+#endif
+		return context;
+	}
+}
@@ -0,0 +1,86 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 09:30
+//
+
+#ifndef AGO_NETWORK_NUMA_NODE_H
+#define AGO_NETWORK_NUMA_NODE_H
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace zmq {
+	class context_t;
+}
+
+namespace agoNetwork {
+	/// @brief **numaNode** places threads and memory on a NUMA node, so a
+	/// router, its context IO threads, its worker lanes and its buffers do
+	/// not cross the interconnect of a multi-socket host.
+	/// The topology is read by libnuma if the library is built with it and
+	/// from /sys otherwise. A host without NUMA is a single node 0.
+	class numaNode final {
+	private: // private data
+		unsigned int _id;
+
+	public: // constructors and destructors
+		explicit
+		numaNode(unsigned int id) noexcept;
+
+	public: // public methods
+		/// @brief Specify the number of the nodes of the host.
+		[[nodiscard]]
+		static unsigned int
+		count() noexcept;
+
+		/// @brief Specify the node which a network interface (e.g. eth0) is
+		/// attached to, so the router is placed next to its NIC and its IRQs.
+		/// @return The node or nothing if it is unknown.
+		[[nodiscard]]
+		static std::optional<numaNode>
+		of(const std::string& interface) noexcept;
+
+		/// @brief Pin the calling thread to the specified CPUs.
+		/// @return true if the thread is pinned and false otherwise.
+		static bool
+		pin(const std::vector<unsigned int>&) noexcept;
+
+		/// @brief Specify the node id.
+		[[nodiscard]]
+		unsigned int
+		id() const noexcept;
+
+		/// @brief Specify the CPUs of the node.
+		[[nodiscard]]
+		std::vector<unsigned int>
+		cpus() const noexcept;
+
+		/// @brief Pin the calling thread to the CPUs of the node. Memory
+		/// which the thread touches first is then allocated on the node.
+		/// @return true if the thread is pinned and false otherwise.
+		bool
+		pin() const noexcept;
+
+		/// @brief Bind the pages of a memory region (e.g. the span of a
+		/// agoNetwork::frameBuffer) to the node. Pages which are already
+		/// touched elsewhere are moved.
+		/// @return true if the region is bound and false otherwise.
+		bool
+		bind(void*, std::size_t) const noexcept;
+
+		/// @brief Make a zmq context whose IO threads run on the CPUs of
+		/// the node (ZMQ_THREAD_AFFINITY_CPU_ADD), to be shared with the
+		/// adapters of the node.
+		/// @param ioThreads Number of the IO threads
+		/// @return The context, its IO threads are not pinned if the zmq
+		/// library does not support it.
+		[[nodiscard]]
+		std::shared_ptr<zmq::context_t>
+		context(unsigned int ioThreads = 1) const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_NUMA_NODE_H
@@ -0,0 +1,202 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:58
+//
+
+#include <bit>
+#include <functional>
+#include <lib/network/peers/peerTable.h>
+
+namespace agoNetwork {
+	namespace {
+		/// The table never shrinks below this number of slots.
+		constexpr std::size_t minimumCapacity{ 16 };
+	}
+
+	peerTable::
+	peerTable(std::size_t capacity) noexcept
+			:_slots(std::bit_ceil(std::max(capacity, minimumCapacity))) { }
+
+	std::size_t peerTable::
+	find_(const std::string& identity, std::size_t hash) const noexcept {
+		const auto mask = _slots.size()-1;
+		for (auto index = hash & mask, probe = std::size_t{ 0 };
+				probe<_slots.size(); index = (index+1) & mask, ++probe) {
+			const auto& _slot = _slots[index];
+			if (_slot.state==slotState::empty) {
+				break;
+			}
+			if (_slot.state==slotState::used
+					&& _slot.hash==hash
+					&& _slot._peer.identity==identity) {
+				return index;
+			}
+		}
+		return _slots.size();
+	}
+
+	peerTable::peer& peerTable::
+	insert_(const std::string& identity, std::size_t hash) noexcept {
+		// keep the load (including the erased slots) at most one half
+		if ((_size+_erased+1)*2>_slots.size()) {
+			rehash_((_size+1)*2>_slots.size()/2 ? _slots.size()*2 : _slots.size());
+		}
+		const auto mask = _slots.size()-1;
+		auto index = hash & mask;
+		while (_slots[index].state==slotState::used) {
+			index = (index+1) & mask;
+		}
+		auto& _slot = _slots[index];
+		if (_slot.state==slotState::erased) {
+			--_erased;
+		}
+		_slot.hash = hash;
+		_slot.state = slotState::used;
+		_slot._peer = peer{ identity, clock::now() };
+		++_size;
+		return _slot._peer;
+	}
+
+	void peerTable::
+	erase_(std::size_t index) noexcept {
+		auto& _slot = _slots[index];
+		_slot.state = slotState::erased;
+		// release the identity memory right away
+		_slot._peer = peer{};
+		--_size;
+		++_erased;
+		if (_slots.size()>minimumCapacity && _size*8<_slots.size()) {
+			rehash_(_slots.size()/2);
+		}
+	}
+
+	void peerTable::
+	rehash_(std::size_t capacity) noexcept {
+		std::vector<slot> slots(std::max(capacity, minimumCapacity));
+		slots.swap(_slots);
+		_size = 0;
+		_erased = 0;
+		const auto mask = _slots.size()-1;
+		for (auto& _slot : slots) {
+			if (_slot.state==slotState::used) {
+				auto index = _slot.hash & mask;
+				while (_slots[index].state==slotState::used) {
+					index = (index+1) & mask;
+				}
+				_slots[index] = std::move(_slot);
+				++_size;
+			}
+		}
+	}
+
+	bool peerTable::
+	touch(const std::string& identity) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto hash = std::hash<std::string>{}(identity);
+		const auto index = find_(identity, hash);
+		const auto inserted = index==_slots.size();
+		if (inserted && not _evicted.empty()) {
+			_evicted.erase(identity);
+		}
+		auto& _peer = inserted
+				? insert_(identity, hash)
+				: _slots[index]._peer;
+		_peer.lastSeen = clock::now();
+		++_peer.received;
+		return inserted;
+	}
+
+	std::optional<bool> peerTable::
+	toggle(const std::string& identity) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto hash = std::hash<std::string>{}(identity);
+		const auto index = find_(identity, hash);
+		if (index==_slots.size()) {
+			if (_evicted.erase(identity)) {
+				// the disconnect of a peer which is evicted already
+				return std::nullopt;
+			}
+			insert_(identity, hash);
+			return true;
+		}
+		erase_(index);
+		return false;
+	}
+
+	bool peerTable::
+	pushed(const std::string& identity) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto index = find_(identity, std::hash<std::string>{}(identity));
+		if (index==_slots.size()) {
+			return false;
+		}
+		++_slots[index]._peer.pushed;
+		return true;
+	}
+
+	bool peerTable::
+	erase(const std::string& identity) noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto index = find_(identity, std::hash<std::string>{}(identity));
+		if (index==_slots.size()) {
+			return false;
+		}
+		erase_(index);
+		return true;
+	}
+
+	std::vector<std::string> peerTable::
+	evict(clock::time_point before) noexcept {
+		std::lock_guard lock{ _mutex };
+		std::vector<std::string> evicted;
+		for (auto& _slot : _slots) {
+			if (_slot.state==slotState::used && _slot._peer.lastSeen<before) {
+				_evicted.insert(_slot._peer.identity);
+				evicted.push_back(std::move(_slot._peer.identity));
+				_slot.state = slotState::erased;
+				_slot._peer = peer{};
+				--_size;
+				++_erased;
+			}
+		}
+		if (not evicted.empty()) {
+			// drop the erased slots and shrink if most of the table is empty
+			auto capacity = _slots.size();
+			while (capacity>minimumCapacity && _size*8<capacity) {
+				capacity /= 2;
+			}
+			rehash_(capacity);
+		}
+		return evicted;
+	}
+
+	std::optional<peerTable::peer> peerTable::
+	find(const std::string& identity) const noexcept {
+		std::lock_guard lock{ _mutex };
+		const auto index = find_(identity, std::hash<std::string>{}(identity));
+		if (index==_slots.size()) {
+			return std::nullopt;
+		}
+		return _slots[index]._peer;
+	}
+
+	std::vector<std::string> peerTable::
+	identities() const noexcept {
+		std::lock_guard lock{ _mutex };
+		std::vector<std::string> identities;
+		identities.reserve(_size);
+		for (const auto& _slot : _slots) {
+			if (_slot.state==slotState::used) {
+				identities.push_back(_slot._peer.identity);
+			}
+		}
+		return identities;
+	}
+
+	std::size_t peerTable::
+	size() const noexcept {
+		std::lock_guard lock{ _mutex };
+		return _size;
+	}
+}
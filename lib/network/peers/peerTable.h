@@ -0,0 +1,143 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:58
+//
+
+#ifndef AGO_NETWORK_PEER_TABLE_H
+#define AGO_NETWORK_PEER_TABLE_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief **peerTable** keeps the peers of a router socket by their
+	/// identity in a flat open addressing table (linear probing), so tens
+	/// of thousands of peers cost one contiguous allocation.
+	/// Erased slots release their identity right away and the table shrinks
+	/// once most of it is empty.
+	class peerTable final {
+	public: // public data
+		using clock = std::chrono::steady_clock;
+
+		/// @brief A known peer.
+		struct peer {
+			/// The peer address as returned by agoNetwork::socket::receive.
+			std::string identity;
+			/// The last time the peer is heard of.
+			clock::time_point lastSeen;
+			/// Number of the messages received from the peer.
+			std::uint64_t received{ 0 };
+			/// Number of the messages pushed to the peer by the router.
+			std::uint64_t pushed{ 0 };
+		};
+
+	private: // private data
+		/// @brief Represents the state of a slot.
+		enum class slotState : std::uint8_t {
+			empty,
+			used,
+			erased,
+		};
+		/// @brief A slot of the table.
+		struct slot {
+			std::size_t hash{ 0 };
+			slotState state{ slotState::empty };
+			peer _peer;
+		};
+		/// The slots, their number is always a power of two.
+		std::vector<slot> _slots;
+		/// Number of the used slots.
+		std::size_t _size{ 0 };
+		/// Number of the erased slots.
+		std::size_t _erased{ 0 };
+		/// The evicted peers which are still connected, their next
+		/// notification is the disconnect.
+		std::unordered_set<std::string> _evicted;
+		/// The table is used by the listening thread and the callers
+		/// which push to the peers.
+		mutable std::mutex _mutex;
+
+	public: // constructors and destructors
+		/// @brief Initialize the table.
+		/// @param capacity Initial number of the slots.
+		explicit
+		peerTable(std::size_t capacity = 64) noexcept;
+
+	private: // private methods
+		/// @brief Find the slot of an identity.
+		/// @return Index of the slot or the number of the slots if the
+		/// identity is unknown.
+		[[nodiscard]]
+		std::size_t
+		find_(const std::string&, std::size_t) const noexcept;
+
+		/// @brief Insert an identity which is known to be missing.
+		/// @return The inserted peer.
+		peer&
+		insert_(const std::string&, std::size_t) noexcept;
+
+		/// @brief Erase the slot at the specified index.
+		void
+		erase_(std::size_t) noexcept;
+
+		/// @brief Move the used slots to a table of the specified capacity.
+		void
+		rehash_(std::size_t) noexcept;
+
+	public: // public methods
+		/// @brief Count a message of a peer, the peer is inserted if unknown.
+		/// @return true if the peer is inserted and false otherwise.
+		bool
+		touch(const std::string&) noexcept;
+
+		/// @brief Handle a connect or disconnect notification of a peer.
+		/// Both look the same, so a known peer is erased and an unknown one
+		/// is inserted, unless it is evicted before, then the notification
+		/// is its disconnect.
+		/// @return true if the peer is known afterwards, false if it is
+		/// erased and nothing if the peer was already evicted.
+		std::optional<bool>
+		toggle(const std::string&) noexcept;
+
+		/// @brief Count a message pushed to a peer.
+		/// @return true if the peer is known and false otherwise.
+		bool
+		pushed(const std::string&) noexcept;
+
+		/// @brief Forget a peer.
+		/// @return true if the peer was known and false otherwise.
+		bool
+		erase(const std::string&) noexcept;
+
+		/// @brief Forget the peers which are not heard of since the specified
+		/// time point, they are remembered until their disconnect
+		/// notification or their next message.
+		/// @return Identities of the evicted peers.
+		std::vector<std::string>
+		evict(clock::time_point) noexcept;
+
+		/// @brief Look a peer up.
+		/// @return A copy of the peer or nothing if it is unknown.
+		[[nodiscard]]
+		std::optional<peer>
+		find(const std::string&) const noexcept;
+
+		/// @brief Specify the identities of all the known peers.
+		[[nodiscard]]
+		std::vector<std::string>
+		identities() const noexcept;
+
+		/// @brief Specify the number of the known peers.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_PEER_TABLE_H
@@ -0,0 +1,200 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:00
+//
+
+#include <lib/network/pipeline/pipeline.h>
+#include <lib/network/zmq/zhelpers.hpp>
+#include <lib/network/log/logger.h>
+
+namespace agoNetwork {
+	pipeline::
+	~pipeline() {
+		stop();
+	}
+
+	std::string pipeline::
+	name_(const endpoint& endpoint_) noexcept {
+		return std::visit([](const auto& model) -> std::string {
+			using model_t = std::decay_t<decltype(model)>;
+			if constexpr (TcpSocket<model_t>) {
+				return model.name+"_.:tcp:._";
+			}
+			else if constexpr (IPCSocket<model_t>) {
+				return model.name+"_.:ipc:._";
+			}
+			else {
+				return model.name+"_.:inproc:._";
+			}
+		}, endpoint_);
+	}
+
+	void pipeline::
+	spawnStage_(
+			const endpoint& in,
+			const endpoint& out,
+			unsigned int workers,
+			const work& work_) noexcept {
+		for (unsigned int worker{ 0 }; worker<workers; ++worker) {
+			auto _puller = std::visit([&](const auto& model) {
+				return std::make_shared<puller>(_contextHandle, model);
+			}, in);
+			auto _pusher = std::visit([&](const auto& model) {
+				return std::make_shared<pusher>(_contextHandle, model);
+			}, out);
+			_puller->prefetch(_prefetch);
+			_puller->connect();
+			_pusher->connect();
+			_puller->registerCallback(
+					name_(in),
+					[_pusher, name = name_(out), work_]
+							(const std::vector<std::string>& task) {
+						if (task.empty()) {
+							return;
+						}
+						_pusher->push(name, work_(task.front()));
+					});
+			_pullers.push_back(_puller);
+			_workers.emplace_back([_puller] {
+				_puller->listen();
+			});
+		}
+	}
+
+	void pipeline::
+	spawnStreamer_(
+			const socketModel::inproc& front,
+			const socketModel::inproc& back) noexcept {
+		auto control = std::make_shared<zmq::socket_t>(_context, ZMQ_PAIR);
+		const auto controlAddress =
+				"inproc://"+front.address+".control.inproc";
+		try {
+			control->bind(controlAddress);
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in binding pipeline streamer control {} on address {}, what? {}",
+					front.name, controlAddress, error.what());
+			return;
+		}
+		_streamerControls.push_back(control);
+		_streamers.emplace_back([&context = _context, front, back,
+				controlAddress, prefetch = _prefetch] {
+			try {
+				zmq::socket_t frontend{ context, ZMQ_PULL };
+				zmq::socket_t backend{ context, ZMQ_PUSH };
+				zmq::socket_t controller{ context, ZMQ_PAIR };
+				backend.setsockopt(ZMQ_SNDHWM, prefetch);
+				frontend.bind("inproc://"+front.address+".inproc");
+				backend.bind("inproc://"+back.address+".inproc");
+				controller.connect(controlAddress);
+				zmq::proxy_steerable(
+						static_cast<void*>(frontend),
+						static_cast<void*>(backend),
+						nullptr,
+						static_cast<void*>(controller));
+			}
+			catch (zmq::error_t& error) {
+				logger::error("Error in pipeline streamer {}, what? {}", front.name, error.what());
+			}
+		});
+	}
+
+	pipeline& pipeline::
+	stage(unsigned int workers, const work& work_) noexcept {
+		_stages.emplace_back(workers, work_);
+		return *this;
+	}
+
+	pipeline& pipeline::
+	sink(const sinkCallback& callback) noexcept {
+		_sinkCallback = callback;
+		return *this;
+	}
+
+	pipeline& pipeline::
+	prefetch(int tasks) noexcept {
+		_prefetch = tasks;
+		return *this;
+	}
+
+	void pipeline::
+	start() noexcept {
+		if (_ventilator) {
+			return;
+		}
+		_ventilator = std::visit([&](const auto& model) {
+			return std::make_shared<pusher>(_contextHandle, model);
+		}, _source);
+		_ventilator->limitQueue(_prefetch);
+		_ventilator->bind();
+		if (_sinkCallback) {
+			auto _puller = std::visit([&](const auto& model) {
+				return std::make_shared<puller>(_contextHandle, model);
+			}, _sink);
+			_puller->bind();
+			_puller->registerCallback(
+					name_(_sink),
+					[callback = _sinkCallback]
+							(const std::vector<std::string>& result) {
+						if (result.empty()) {
+							return;
+						}
+						callback(result.front());
+					});
+			_pullers.push_back(_puller);
+			_workers.emplace_back([_puller] {
+				_puller->listen();
+			});
+		}
+		// the links between two stages are bound by streamers,
+		// so the workers of both stages could simply connect to them.
+		endpoint in{ _source };
+		for (std::size_t stageIndex{ 0 };
+				stageIndex<_stages.size(); ++stageIndex) {
+			const auto&[workers, work_] = _stages[stageIndex];
+			if (stageIndex+1==_stages.size()) {
+				spawnStage_(in, _sink, workers, work_);
+				break;
+			}
+			const auto link = "pipeline.link"+std::to_string(stageIndex);
+			socketModel::inproc front{ link+".front", link+".front" };
+			socketModel::inproc back{ link+".back", link+".back" };
+			spawnStreamer_(front, back);
+			spawnStage_(in, front, workers, work_);
+			in = back;
+		}
+	}
+
+	void pipeline::
+	push(const std::string& task) noexcept {
+		if (_ventilator) {
+			_ventilator->push(name_(_source), task);
+		}
+	}
+
+	void pipeline::
+	stop() noexcept {
+		for (const auto& _puller : _pullers) {
+			_puller->stop();
+		}
+		for (auto& worker : _workers) {
+			if (worker.joinable()) {
+				worker.join();
+			}
+		}
+		for (const auto& control : _streamerControls) {
+			s_send(*control, "TERMINATE");
+		}
+		for (auto& streamer : _streamers) {
+			if (streamer.joinable()) {
+				streamer.join();
+			}
+		}
+		_workers.clear();
+		_streamers.clear();
+		_streamerControls.clear();
+		_pullers.clear();
+		_ventilator.reset();
+	}
+}
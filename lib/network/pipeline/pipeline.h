@@ -0,0 +1,132 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:13
+//
+
+#ifndef AGO_NETWORK_PIPELINE_H
+#define AGO_NETWORK_PIPELINE_H
+
+#include <thread>
+#include <variant>
+#include <lib/network/pusher/pusher.h>
+#include <lib/network/puller/puller.h>
+
+namespace agoNetwork {
+	/// @brief **pipeline** chains a ventilator, one or more stages of
+	/// workers and a sink together:
+	///
+	/// ventilator -> stage workers -> ... -> stage workers -> sink
+	///
+	/// Every worker runs on its own thread and pulls its tasks from the
+	/// previous link, so the tasks are load balanced across the workers.
+	/// The links between the stages are inproc streamers which live in the
+	/// pipeline context, the source and the sink could be tcp, ipc or inproc.
+	class pipeline final : private zmqContext {
+	private: // private data
+		/// endpoint holds one of the socket models.
+		using endpoint = std::variant<
+				socketModel::tcp,
+				socketModel::ipc,
+				socketModel::inproc>;
+		/// work is a function alias which gets a task and returns its result.
+		/// The result is pushed to the next link of the pipeline.
+		using work = std::function<std::string(const std::string&)>;
+		/// sinkCallback is a function alias which gets a result.
+		using sinkCallback = std::function<void(const std::string&)>;
+		/// The endpoint which the ventilator binds to.
+		endpoint _source;
+		/// The endpoint which the last stage pushes its results to.
+		endpoint _sink;
+		/// Number of workers and the work of each stage.
+		std::vector<std::pair<unsigned int, work>> _stages;
+		/// Called for each result if the sink is served by the pipeline.
+		sinkCallback _sinkCallback;
+		/// Maximum number of tasks queued for each worker, on each side.
+		int _prefetch{ 1 };
+		/// The ventilator which pushes to pipeline::_source.
+		std::shared_ptr<pusher> _ventilator;
+		/// Workers and the sink pullers, kept in order to stop them.
+		std::vector<std::shared_ptr<puller>> _pullers;
+		/// Control sockets of the streamers between the stages.
+		std::vector<std::shared_ptr<zmq::socket_t>> _streamerControls;
+		/// Worker and sink threads.
+		std::vector<std::thread> _workers;
+		/// Streamer threads.
+		std::vector<std::thread> _streamers;
+
+	public: // constructors and destructors
+		/// @brief Initialize the pipeline endpoints.
+		/// @tparam source_t is ::Socket concept which the ventilator binds to.
+		/// @tparam sink_t is ::Socket concept which the sink binds to.
+		/// @param source is the ventilator endpoint.
+		/// @param sink is the sink endpoint.
+		/// @param io_thread is the number of the context I/O threads.
+		template<Socket source_t, Socket sink_t>
+		explicit
+		pipeline(source_t source, sink_t sink, unsigned int io_thread = 1)
+		noexcept
+				:zmqContext{ io_thread },
+				 _source{ std::move(source) },
+				 _sink{ std::move(sink) } { }
+
+		/// @brief Stop all the workers.
+		~pipeline();
+
+	private: // private methods
+		/// @brief Specify the registered name of an endpoint.
+		/// @return The endpoint name followed by its protocol suffix.
+		[[nodiscard]]
+		static std::string
+		name_(const endpoint&) noexcept;
+
+		/// @brief Spawn the workers of a stage which pull from the first
+		/// endpoint and push to the second one.
+		void
+		spawnStage_(const endpoint&, const endpoint&, unsigned int,
+				const work&) noexcept;
+
+		/// @brief Spawn a streamer which pulls from the first endpoint and
+		/// pushes to the second one, queueing up to the prefetch of the
+		/// pipeline for each worker.
+		void
+		spawnStreamer_(const socketModel::inproc&,
+				const socketModel::inproc&) noexcept;
+
+	public: // public methods
+		/// @brief Append a stage to the pipeline.
+		/// @param workers Number of the workers of the stage.
+		/// @param work_ Invocable object which maps a task to its result.
+		/// @return The pipeline itself in order to chain the stages.
+		pipeline&
+		stage(unsigned int workers, const work& work_) noexcept;
+
+		/// @brief Serve the sink inside the pipeline.
+		/// If no sink callback is set, the sink endpoint is supposed to be
+		/// bound by another process.
+		/// @return The pipeline itself.
+		pipeline&
+		sink(const sinkCallback&) noexcept;
+
+		/// @brief Specify the maximum number of tasks queued for each worker,
+		/// on the side of the worker and on the side of its pusher each.
+		/// @note It should be called before pipeline::start.
+		/// @return The pipeline itself.
+		pipeline&
+		prefetch(int) noexcept;
+
+		/// @brief Bind the ventilator and the sink and spawn the workers.
+		void
+		start() noexcept;
+
+		/// @brief Push a task to the first stage.
+		void
+		push(const std::string&) noexcept;
+
+		/// @brief Stop the workers, the streamers and the sink.
+		void
+		stop() noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_PIPELINE_H
@@ -0,0 +1,96 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:38
+//
+
+#include <algorithm>
+#include <lib/network/poller/busyPoller.h>
+#include <lib/network/numa/numaNode.h>
+
+namespace agoNetwork {
+	namespace {
+		/// Number of spins between the polls of all the items.
+		constexpr std::size_t fullPollPeriod{ 64 };
+
+		/// @brief Let the sibling hyper-thread run while spinning.
+		inline void
+		relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+#elif defined(__aarch64__)
+			asm volatile("yield");
+#endif
+		}
+	}
+
+	busyPoller::
+	busyPoller(std::chrono::microseconds spin) noexcept
+			:_spin{ spin },
+			 _active{ clock::now() } {}
+
+	int busyPoller::
+	poll(std::vector<zmq::pollitem_t>& polls, long timeout) {
+		const auto start = clock::now();
+		if (_spin.count()>0 && start-_active<_spin) {
+			auto until = _active+_spin;
+			if (timeout>=0) {
+				until = std::min(until, start+std::chrono::milliseconds{ timeout });
+			}
+			for (std::size_t spins{ 1 }; clock::now()<until; ++spins) {
+				if (spins%fullPollPeriod==0) {
+					if (const auto ready = zmq::poll(polls.data(), polls.size(), 0)) {
+						_active = clock::now();
+						return ready;
+					}
+					continue;
+				}
+				int ready{ 0 };
+				bool failed{ false };
+				for (auto& item : polls) {
+					item.revents = 0;
+					if (item.socket==nullptr || item.events==0) {
+						continue;
+					}
+					int events{ 0 };
+					std::size_t size{ sizeof(events) };
+					if (zmq_getsockopt(item.socket, ZMQ_EVENTS, &events, &size)!=0) {
+						// zmq::poll reports the error
+						failed = true;
+						break;
+					}
+					item.revents = static_cast<short>(events & item.events);
+					ready += item.revents!=0;
+				}
+				if (failed) {
+					break;
+				}
+				if (ready>0) {
+					_active = clock::now();
+					return ready;
+				}
+				relax();
+			}
+			if (timeout>=0) {
+				const auto spent = std::chrono::duration_cast<std::chrono::milliseconds>(
+						clock::now()-start).count();
+				timeout = std::max<long>(timeout-spent, 0);
+			}
+		}
+		const auto ready = zmq::poll(polls.data(), polls.size(), timeout);
+		if (ready>0) {
+			_active = clock::now();
+		}
+		return ready;
+	}
+
+	void busyPoller::
+	active() noexcept {
+		_active = clock::now();
+	}
+
+	bool busyPoller::
+	pin(const std::vector<unsigned int>& cpus) noexcept {
+		return numaNode::pin(cpus);
+	}
+}
@@ -0,0 +1,66 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:33
+//
+
+#ifndef AGO_NETWORK_BUSY_POLLER_H
+#define AGO_NETWORK_BUSY_POLLER_H
+
+#include <chrono>
+#include <vector>
+#include <zmq.hpp>
+
+namespace agoNetwork {
+	/// @brief Options of the busy poll mode.
+	struct busyPollOptions {
+		/// How long the poll loop keeps spinning after its last activity
+		/// before it blocks, zero turns busy polling off.
+		std::chrono::microseconds spin{ 0 };
+		/// CPUs which the spinning threads are pinned to, none means they
+		/// are not pinned.
+		std::vector<unsigned int> cpus;
+	};
+
+	/// @brief **busyPoller** polls zmq sockets with low latency by trading
+	/// a core for it. Right after any activity it spins on the readiness of
+	/// the sockets (ZMQ_EVENTS, which never blocks) instead of sleeping in
+	/// zmq::poll, and once nothing happens for the spin period it falls
+	/// back to the blocking zmq::poll, so an idle loop does not burn a core.
+	class busyPoller final {
+	public: // public data
+		using clock = std::chrono::steady_clock;
+
+	private: // private data
+		std::chrono::microseconds _spin;
+		/// The last time anything was ready or the loop was told so.
+		clock::time_point _active;
+
+	public: // constructors and destructors
+		explicit
+		busyPoller(std::chrono::microseconds spin = {}) noexcept;
+
+	public: // public methods
+		/// @brief Poll the items like zmq::poll does, spinning first if the
+		/// last activity is recent enough.
+		/// The items of raw file descriptors are polled once in a while
+		/// when spinning, so they are noticed a bit later than the sockets.
+		/// @param timeout How long to wait, -1 waits until anything happens.
+		/// @return Number of the ready items.
+		/// @warning It throws zmq::error_t as zmq::poll does.
+		int
+		poll(std::vector<zmq::pollitem_t>&, long timeout);
+
+		/// @brief Make the poller spin on its next poll, e.g. once a request
+		/// is sent and its reply is awaited.
+		void
+		active() noexcept;
+
+		/// @brief Pin the calling thread to the specified CPUs.
+		/// @return true if the thread is pinned and false otherwise.
+		static bool
+		pin(const std::vector<unsigned int>&) noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_BUSY_POLLER_H
@@ -0,0 +1,226 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:23
+//
+
+#include <regex>
+#include <lib/network/puller/puller.h>
+#include <lib/network/log/logger.h>
+
+namespace agoNetwork {
+	void puller::
+	registerSocket_(zmq::context_t& context,
+			const socketModel::tcp& _socket) {
+		if (not _socket.name.empty() && not _socket.address.empty()) {
+			if (validateURI_(_socket.address)) {
+				_tcpSocket.insert({
+						_socket.name+"_.:tcp:._",
+						std::make_shared<tcpSocket>(
+								tcpSocket{
+										_socket.name,
+										_socket.address,
+										socketType::pull,
+										context
+								})
+				});
+			}
+			else {
+				throw (std::runtime_error(
+						"Could not validate "
+								+_socket.address
+								+"\nvalid uri: ipv4:port"));
+			}
+		}
+	}
+
+	void puller::
+	registerSocket_(zmq::context_t& context,
+			const socketModel::ipc& _socket)
+	noexcept {
+		if (not _socket.name.empty() && not _socket.address.empty()) {
+			_ipcSocket.insert({
+					_socket.name+"_.:ipc:._",
+					std::make_shared<ipcSocket>(
+							ipcSocket{
+									_socket.name,
+									_socket.address,
+									socketType::pull,
+									context
+							})
+			});
+		}
+	}
+
+	void puller::
+	registerSocket_(zmq::context_t& context,
+			const socketModel::inproc& _socket)
+	noexcept {
+		if (not _socket.name.empty() && not _socket.address.empty()) {
+			_inprocSocket.insert({
+					_socket.name+"_.:inproc:._",
+					std::make_shared<inprocSocket>(
+							inprocSocket{
+									_socket.name,
+									_socket.address,
+									socketType::pull,
+									context
+							})
+			});
+		}
+	}
+
+	void puller::
+	registerCallback_(const std::string& name, const callback& callback)
+	noexcept {
+		if (_tcpSocket.contains(name)
+				|| _ipcSocket.contains(name)
+				|| _inprocSocket.contains(name)) {
+			_callbacks.insert({
+					name,
+					callback
+			});
+		}
+	}
+
+	bool puller::
+	validateURI_(const std::string& uri) const noexcept {
+		std::regex tcpAddress{
+				"^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\\.){3}"
+				"([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])):([0-9]+)$"
+		};
+		return (std::regex_search(uri.c_str(), tcpAddress));
+	}
+
+	void puller::
+	bind() noexcept {
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			socket->bind();
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			socket->bind();
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			socket->bind();
+		}
+	}
+
+	void puller::
+	connect() noexcept {
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			socket->connect();
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			socket->connect();
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			socket->connect();
+		}
+	}
+
+	void puller::
+	prefetch(int messages) noexcept {
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			(**socket)->setsockopt(ZMQ_RCVHWM, messages);
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			(**socket)->setsockopt(ZMQ_RCVHWM, messages);
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			(**socket)->setsockopt(ZMQ_RCVHWM, messages);
+		}
+	}
+
+	std::vector<std::string> puller::
+	pull(const std::string& name) noexcept {
+		if (_tcpSocket.contains(name)) {
+			return _tcpSocket[name]->receive();
+		}
+		else if (_ipcSocket.contains(name)) {
+			return _ipcSocket[name]->receive();
+		}
+		else if (_inprocSocket.contains(name)) {
+			return _inprocSocket[name]->receive();
+		}
+		return {};
+	}
+
+	void puller::
+	listen() noexcept {
+		std::vector<zmq::pollitem_t> polls;
+		std::vector<std::string> socketPairPoll;
+		for (auto &[socketName, socket] : _tcpSocket) {
+			polls.push_back(
+					zmq::pollitem_t{
+							static_cast<void*>(***socket),
+							0,
+							ZMQ_POLLIN,
+							0
+					}
+			);
+			socketPairPoll.push_back(socketName);
+		}
+		for (auto &[socketName, socket] : _ipcSocket) {
+			polls.push_back(
+					zmq::pollitem_t{
+							static_cast<void*>(***socket),
+							0,
+							ZMQ_POLLIN,
+							0
+					}
+			);
+			socketPairPoll.push_back(socketName);
+		}
+		for (auto &[socketName, socket] : _inprocSocket) {
+			polls.push_back(
+					zmq::pollitem_t{
+							static_cast<void*>(***socket),
+							0,
+							ZMQ_POLLIN,
+							0
+					}
+			);
+			socketPairPoll.push_back(socketName);
+		}
+		while (not _stopping) {
+			try {
+				// wake up periodically in order to honor puller::stop
+				zmq::poll(polls, 100);
+				int socketIndex{ -1 };
+				for (const auto& item : polls) {
+					++socketIndex;
+					if (item.revents & ZMQ_POLLIN) {
+						const auto& _socket_name = socketPairPoll[socketIndex];
+						auto req = pull(_socket_name);
+						auto[rangeBegin, rangeEnd] =
+						_callbacks.equal_range(_socket_name);
+						for (
+								auto callback = rangeBegin;
+								callback!=rangeEnd;
+								++callback) {
+							callback->second(req);
+						}
+					}
+				}
+			}
+			catch (zmq::error_t& error) {
+				if (error.num()==ETERM) {
+					break;
+				}
+				logger::error("Error in pulling, what? {}", error.what());
+			}
+			catch (const std::exception& error) {
+				logger::error("Error in pulling, what? {}", error.what());
+			}
+			catch (...) {
+				logger::error("Unknown error in pulling");
+			}
+		}
+		_stopping = false;
+	}
+
+	void puller::
+	stop() noexcept {
+		_stopping = true;
+	}
+}
@@ -0,0 +1,153 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:13
+//
+
+#ifndef AGO_NETWORK_PULLER_H
+#define AGO_NETWORK_PULLER_H
+
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <lib/concepts/concepts.h>
+#include <lib/network/zmq/zmqContext.h>
+
+namespace agoNetwork {
+	/// @brief **puller** is the *zmq pull* adapter
+	/// which receives the tasks distributed by pushers.
+	/// Messages of all the connected pushers are fair-queued by zmq itself.
+	class puller final : private zmqContext {
+	private: // private data
+		/// Maps socket name to a tcpSocket shared pointer.
+		std::unordered_map
+				<std::string, std::shared_ptr<tcpSocket>> _tcpSocket;
+		/// Maps socket name to a ipcSocket shared pointer.
+		std::unordered_map
+				<std::string, std::shared_ptr<ipcSocket>> _ipcSocket;
+		/// Maps socket name to a inprocSocket shared pointer.
+		std::unordered_map
+				<std::string, std::shared_ptr<inprocSocket>> _inprocSocket;
+		/// callback is a function alias which gets the pulled message.
+		/// pull sockets could not reply, so the socket is not passed.
+		using callback =
+		std::function<void(const std::vector<std::string>&)>;
+		/// Maps socket name to callback.
+		std::unordered_multimap<std::string, callback> _callbacks;
+		/// Specify whether puller::stop is requested.
+		std::atomic_bool _stopping{ false };
+
+	public: // constructors and destructors
+		/// @brief Registers sockets.
+		/// The puller constructor simply calls the
+		/// puller::registerSocket_ function
+		/// and passes the puller::_context and socket respectively.
+		/// @tparam socket_t is ::Socket concept which is either
+		/// agoNetwork::socketModel::tcp,
+		/// agoNetwork::socketModel::ipc or
+		/// agoNetwork::socketModel::inproc.
+		/// @see concepts.h
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		puller(socket_t ... socket) noexcept {
+			(registerSocket_(_context, socket), ...);
+		}
+
+		/// @brief Registers sockets on a shared context.
+		/// @note inproc sockets must share the context with their pairs.
+		/// @param context is the shared zmq context.
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		puller(std::shared_ptr<zmq::context_t> context, socket_t ... socket)
+		noexcept
+				:zmqContext{ std::move(context) } {
+			(registerSocket_(_context, socket), ...);
+		}
+
+	private:
+		/// @brief Registers tcp sockets in puller::_tcpSocket.
+		/// @warning This function could throw a runtime error if the specified
+		/// address (URI) of the tcp socket be invalid.
+		/// @see puller::validateURI_
+		void
+		registerSocket_(zmq::context_t&, const socketModel::tcp&);
+
+		/// @brief Registers ipc sockets in puller::_ipcSocket.
+		void
+		registerSocket_(zmq::context_t&, const socketModel::ipc&)
+		noexcept;
+
+		/// @brief Registers inproc sockets in puller::_inprocSocket.
+		void
+		registerSocket_(zmq::context_t&, const socketModel::inproc&)
+		noexcept;
+
+	private:
+		/// @brief Registers puller::callback in puller::_callbacks.
+		void
+		registerCallback_(const std::string&, const callback&) noexcept;
+
+		/// @brief Validate specified uri for the tcp protocol.
+		/// valid uri for the tcp protocol is <IPV4>:<PORT>
+		/// @return true if uri was valid and false otherwise.
+		[[nodiscard]]
+		bool
+		validateURI_(const std::string&) const noexcept;
+
+	public:
+		/// @brief Registers callbacks.
+		/// @tparam pullerCallback_ is ::pullerCallback concept which is
+		/// a function that gets a const reference to std::vector of
+		/// std::string which holds the pulled message.
+		/// @param name Name of the registered socket
+		/// @param callback_ Invocable object like a lambda
+		template<pullerCallback... pullerCallback_>
+		void
+		registerCallback(
+				const std::string& name,
+				const pullerCallback_& ... callback_)
+		noexcept {
+			(registerCallback_(name, callback_), ...);
+		}
+
+	public: // public methods
+		/// @brief Make all the registered sockets bind to their address.
+		/// It is used by the sink side of a pipeline.
+		void
+		bind() noexcept;
+
+		/// @brief Make all the registered sockets connect to their address.
+		/// It is used by the workers which pull their tasks from a ventilator.
+		void
+		connect() noexcept;
+
+		/// @brief Limit the number of messages which are queued on this side
+		/// for this puller. The pusher queues up to its own limit for each
+		/// puller as well, so a slow worker is kept from hoarding tasks only
+		/// if both are small, see pusher::limitQueue.
+		/// @note It should be called before bind or connect.
+		void
+		prefetch(int) noexcept;
+
+		/// @brief Pull one message from the specified socket (by its name).
+		/// It blocks until a message arrives.
+		/// @return The pulled message or an empty vector if the socket
+		/// is not registered.
+		std::vector<std::string>
+		pull(const std::string&) noexcept;
+
+		/// @brief Pull messages from all the registered sockets and call the
+		/// corresponded callbacks until puller::stop is called.
+		void
+		listen() noexcept;
+
+		/// @brief Make the current (or the next) puller::listen return.
+		/// It could be called from any thread.
+		void
+		stop() noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_PULLER_H
@@ -0,0 +1,133 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:13
+//
+
+#include <regex>
+#include <lib/network/pusher/pusher.h>
+
+namespace agoNetwork {
+	void pusher::
+	registerSocket_(zmq::context_t& context,
+			const socketModel::tcp& _socket) {
+		if (not _socket.name.empty() && not _socket.address.empty()) {
+			if (validateURI_(_socket.address)) {
+				_tcpSocket.insert({
+						_socket.name+"_.:tcp:._",
+						std::make_shared<tcpSocket>(
+								tcpSocket{
+										_socket.name,
+										_socket.address,
+										socketType::push,
+										context
+								})
+				});
+			}
+			else {
+				throw (std::runtime_error(
+						"Could not validate "
+								+_socket.address
+								+"\nvalid uri: ipv4:port"));
+			}
+		}
+	}
+
+	void pusher::
+	registerSocket_(zmq::context_t& context,
+			const socketModel::ipc& _socket)
+	noexcept {
+		if (not _socket.name.empty() && not _socket.address.empty()) {
+			_ipcSocket.insert({
+					_socket.name+"_.:ipc:._",
+					std::make_shared<ipcSocket>(
+							ipcSocket{
+									_socket.name,
+									_socket.address,
+									socketType::push,
+									context
+							})
+			});
+		}
+	}
+
+	void pusher::
+	registerSocket_(zmq::context_t& context,
+			const socketModel::inproc& _socket)
+	noexcept {
+		if (not _socket.name.empty() && not _socket.address.empty()) {
+			_inprocSocket.insert({
+					_socket.name+"_.:inproc:._",
+					std::make_shared<inprocSocket>(
+							inprocSocket{
+									_socket.name,
+									_socket.address,
+									socketType::push,
+									context
+							})
+			});
+		}
+	}
+
+	bool pusher::
+	validateURI_(const std::string& uri) const noexcept {
+		std::regex tcpAddress{
+				"^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\\.){3}"
+				"([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])):([0-9]+)$"
+		};
+		return (std::regex_search(uri.c_str(), tcpAddress));
+	}
+
+	void pusher::
+	bind() noexcept {
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			socket->bind();
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			socket->bind();
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			socket->bind();
+		}
+	}
+
+	void pusher::
+	connect() noexcept {
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			socket->connect();
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			socket->connect();
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			socket->connect();
+		}
+	}
+
+	void pusher::
+	limitQueue(int messages) noexcept {
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			(**socket)->setsockopt(ZMQ_SNDHWM, messages);
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			(**socket)->setsockopt(ZMQ_SNDHWM, messages);
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			(**socket)->setsockopt(ZMQ_SNDHWM, messages);
+		}
+	}
+
+	void pusher::
+	push(const std::string& name, const std::string& message)
+	noexcept {
+		if (_tcpSocket.contains(name)) {
+			_tcpSocket[name]->send({}, message);
+		}
+		else if (_ipcSocket.contains(name)) {
+			_ipcSocket[name]->send({}, message);
+		}
+		else if (_inprocSocket.contains(name)) {
+			_inprocSocket[name]->send({}, message);
+		}
+	}
+}
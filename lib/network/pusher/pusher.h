@@ -0,0 +1,112 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:13
+//
+
+#ifndef AGO_NETWORK_PUSHER_H
+#define AGO_NETWORK_PUSHER_H
+
+#include <unordered_map>
+#include <lib/concepts/concepts.h>
+#include <lib/network/zmq/zmqContext.h>
+
+namespace agoNetwork {
+	/// @brief **pusher** is the *zmq push* adapter
+	/// which distributes tasks over the connected pullers.
+	/// Messages are load balanced between the connected pullers in a
+	/// round-robin manner by zmq itself.
+	class pusher final : private zmqContext {
+	private: // private data
+		/// Maps socket name to a tcpSocket shared pointer.
+		std::unordered_map
+				<std::string, std::shared_ptr<tcpSocket>> _tcpSocket;
+		/// Maps socket name to a ipcSocket shared pointer.
+		std::unordered_map
+				<std::string, std::shared_ptr<ipcSocket>> _ipcSocket;
+		/// Maps socket name to a inprocSocket shared pointer.
+		std::unordered_map
+				<std::string, std::shared_ptr<inprocSocket>> _inprocSocket;
+
+	public: // constructors and destructors
+		/// @brief Registers sockets.
+		/// The pusher constructor simply calls the
+		/// pusher::registerSocket_ function
+		/// and passes the pusher::_context and socket respectively.
+		/// @tparam socket_t is ::Socket concept which is either
+		/// agoNetwork::socketModel::tcp,
+		/// agoNetwork::socketModel::ipc or
+		/// agoNetwork::socketModel::inproc.
+		/// @see concepts.h
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		pusher(socket_t ... socket) noexcept {
+			(registerSocket_(_context, socket), ...);
+		}
+
+		/// @brief Registers sockets on a shared context.
+		/// @note inproc sockets must share the context with their pairs.
+		/// @param context is the shared zmq context.
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		pusher(std::shared_ptr<zmq::context_t> context, socket_t ... socket)
+		noexcept
+				:zmqContext{ std::move(context) } {
+			(registerSocket_(_context, socket), ...);
+		}
+
+	private:
+		/// @brief Registers tcp sockets in pusher::_tcpSocket.
+		/// @warning This function could throw a runtime error if the specified
+		/// address (URI) of the tcp socket be invalid.
+		/// @see pusher::validateURI_
+		void
+		registerSocket_(zmq::context_t&, const socketModel::tcp&);
+
+		/// @brief Registers ipc sockets in pusher::_ipcSocket.
+		void
+		registerSocket_(zmq::context_t&, const socketModel::ipc&)
+		noexcept;
+
+		/// @brief Registers inproc sockets in pusher::_inprocSocket.
+		void
+		registerSocket_(zmq::context_t&, const socketModel::inproc&)
+		noexcept;
+
+	private:
+		/// @brief Validate specified uri for the tcp protocol.
+		/// valid uri for the tcp protocol is <IPV4>:<PORT>
+		/// @return true if uri was valid and false otherwise.
+		[[nodiscard]]
+		bool
+		validateURI_(const std::string&) const noexcept;
+
+	public: // public methods
+		/// @brief Make all the registered sockets bind to their address.
+		/// It is used by the ventilator side of a pipeline.
+		void
+		bind() noexcept;
+
+		/// @brief Make all the registered sockets connect to their address.
+		/// It is used by the workers which push their results to a sink.
+		void
+		connect() noexcept;
+
+		/// @brief Limit the number of messages which are queued on this side
+		/// for each connected puller, see puller::prefetch for the other side.
+		/// A full queue is skipped, so small limits on both sides keep a slow
+		/// worker from hoarding tasks that other workers could process.
+		/// @note It should be called before bind or connect.
+		void
+		limitQueue(int) noexcept;
+
+		/// @brief Make the specified socket (by its name)
+		/// push a message to one of its connected pullers.
+		void
+		push(const std::string&, const std::string&) noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_PUSHER_H
@@ -8,24 +8,30 @@
 #include <regex>
 #include <future>
 #include <lib/network/router/router.h>
-
-using namespace std::chrono_literals;
+#include <lib/network/log/logger.h>
 
 namespace agoNetwork {
+	router::
+	~router() {
+		_dispatcher.reset();
+	}
+
 	void router::
 	registerSocket_(zmq::context_t& context,
 			const socketModel::tcp& _socket) {
 		if (not _socket.name.empty() && not _socket.address.empty()) {
 			if (validateURI_(_socket.address)) {
+				auto socket = std::make_shared<tcpSocket>(
+						tcpSocket{
+								_socket.name,
+								_socket.address,
+								socketType::router,
+								context
+						});
+				socket->heartbeat(_socket.heartbeat);
 				_tcpSocket.insert({
 						_socket.name+"_.:tcp:._",
-						std::make_shared<tcpSocket>(
-								tcpSocket{
-										_socket.name,
-										_socket.address,
-										socketType::router,
-										context
-								})
+						socket
 				});
 			}
 			else {
@@ -42,15 +48,17 @@ namespace agoNetwork {
 			const socketModel::ipc& _socket)
 	noexcept {
 		if (not _socket.name.empty() && not _socket.address.empty()) {
+			auto socket = std::make_shared<ipcSocket>(
+					ipcSocket{
+							_socket.name,
+							_socket.address,
+							socketType::router,
+							context
+					});
+			socket->heartbeat(_socket.heartbeat);
 			_ipcSocket.insert({
 					_socket.name+"_.:ipc:._",
-					std::make_shared<ipcSocket>(
-							ipcSocket{
-									_socket.name,
-									_socket.address,
-									socketType::router,
-									context
-							})
+					socket
 			});
 		}
 	}
@@ -82,12 +90,8 @@ namespace agoNetwork {
 						socket->bind();
 					}
 					catch (zmq::error_t& error) {
-						std::cout
-								<< "Error in binding to tcp socket "
-								<< socketName
-								<< ", what? "
-								<< error.what()
-								<< std::endl;
+						logger::error("Error in binding to tcp socket {}, what? {}",
+								socketName, error.what());
 					}
 				}
 			});
@@ -97,12 +101,8 @@ namespace agoNetwork {
 						socket->bind();
 					}
 					catch (zmq::error_t& error) {
-						std::cout
-								<< "Error in binding to ipc socket "
-								<< socketName
-								<< ", what? "
-								<< error.what()
-								<< std::endl;
+						logger::error("Error in binding to ipc socket {}, what? {}",
+								socketName, error.what());
 					}
 				}
 			});
@@ -112,12 +112,8 @@ namespace agoNetwork {
 						socket->bind();
 					}
 					catch (zmq::error_t& error) {
-						std::cout
-								<< "Error in binding to inproc socket "
-								<< socketName
-								<< ", what? "
-								<< error.what()
-								<< std::endl;
+						logger::error("Error in binding to inproc socket {}, what? {}",
+								socketName, error.what());
 					}
 				}
 			});
@@ -128,8 +124,31 @@ namespace agoNetwork {
 		}
 	}
 
+	void router::
+	prepare_() noexcept {
+		if (_lanes>0 && not _dispatcher) {
+			_dispatcher = std::make_unique<dispatcher>(
+					_lanes,
+					_node ? _node->cpus() : std::vector<unsigned int>{});
+		}
+		// the routes are read only while listening
+		for (auto&[socketName, table] : _tcpRoutes) {
+			table.trie.build();
+		}
+		for (auto&[socketName, table] : _ipcRoutes) {
+			table.trie.build();
+		}
+		for (auto&[socketName, table] : _inprocRoutes) {
+			table.trie.build();
+		}
+	}
+
 	void router::
 	listen_() noexcept {
+		if (_reactor) {
+			return;
+		}
+		prepare_();
 		auto _ = std::async(std::launch::async, [&] {
 			listen_on_tcp_();
 		});
@@ -142,17 +161,44 @@ namespace agoNetwork {
 		_.wait();
 		__.wait();
 		___.wait();
+		// the lanes are joined first, so their replies are all queued and
+		// no lane sends on a socket once it is not owned anymore
+		_dispatcher.reset();
+		for (const auto&[socketName, socket] : _tcpSocket) {
+			socket->disown();
+		}
+		for (const auto&[socketName, socket] : _ipcSocket) {
+			socket->disown();
+		}
+		for (const auto&[socketName, socket] : _inprocSocket) {
+			socket->disown();
+		}
+		if (_stopping.exchange(false)) {
+			// the sockets stay bound, so the router could listen again
+			_status = routerStatus::bound;
+		}
 	}
 
+	template<typename socket_t, typename callback_t>
 	void router::
-	listen_on_tcp_() noexcept {
-		if (not listeningOnTcp_()) {
-			if (not _tcpSocket.empty()) {
+	listenOn_(
+			std::unordered_map<std::string, std::shared_ptr<socket_t>>& sockets,
+			const std::unordered_multimap<std::string, callback_t>& callbacks,
+			const std::unordered_map<std::string, routing<callback_t>>& routes,
+			routerStatus&& status,
+			bool (router::*listening)() const noexcept) noexcept {
+		if (not (this->*listening)()) {
+			if (not sockets.empty()) {
 				bind_();
-				status_(routerStatus::listeningOnTcp);
+				status_(std::move(status));
+				// the outboxes keep the wakeup alive once the loop is gone
+				const auto _wakeup_ = std::make_shared<wakeup>();
+				auto& _wakeup = *_wakeup_;
 				std::vector<zmq::pollitem_t> polls;
 				std::vector<std::string> socketPairPoll;
-				for (auto &[socketName, socket] : _tcpSocket) {
+				std::vector<std::shared_ptr<socket_t>> polledSockets;
+				std::vector<std::shared_ptr<const binding<callback_t>>> bindings;
+				for (auto &[socketName, socket] : sockets) {
 					polls.push_back(
 							zmq::pollitem_t{
 									static_cast<void*>(***socket),
@@ -162,135 +208,530 @@ namespace agoNetwork {
 							}
 					);
 					socketPairPoll.push_back(socketName);
+					polledSockets.push_back(socket);
+					bindings.push_back(binding_(socketName, callbacks, routes));
+					// replies sent by the worker lanes are flushed by this thread
+					socket->own([_wakeup_] {
+						_wakeup_->notify();
+					});
+				}
+				polls.push_back(
+						zmq::pollitem_t{
+								nullptr,
+								_wakeup.fd(),
+								ZMQ_POLLIN,
+								0
+						}
+				);
+				{
+					std::lock_guard lock{ _mutex };
+					_wakeups.push_back(&_wakeup);
 				}
-				while (listeningOnTcp_()) {
+				busyPoller poller{ _busyPoll.spin };
+				const auto cpus = not _busyPoll.cpus.empty()
+						? _busyPoll.cpus
+						: _node ? _node->cpus() : std::vector<unsigned int>{};
+				if (not cpus.empty() && not numaNode::pin(cpus)) {
+					logger::warning("Error in pinning the listening thread of socket {}",
+							socketPairPoll.front());
+				}
+				while ((this->*listening)() && not _stopping) {
 					try {
-						zmq::poll(polls);
-						int socketIndex{ -1 };
-						for (const auto& item : polls) {
-							++socketIndex;
-							if (item.revents==ZMQ_POLLIN) {
-								auto _socket_name = socketPairPoll[socketIndex];
-								auto _socket = _tcpSocket[_socket_name];
+						for (std::size_t socketIndex{ 0 };
+								socketIndex<socketPairPoll.size(); ++socketIndex) {
+							polls[socketIndex].events =
+									paused_(socketPairPoll[socketIndex]) ? 0 : ZMQ_POLLIN;
+						}
+						poller.poll(polls, pollTimeout_(socketPairPoll));
+						for (std::size_t socketIndex{ 0 };
+								socketIndex<socketPairPoll.size(); ++socketIndex) {
+							if (polls[socketIndex].revents & ZMQ_POLLIN) {
+								const auto& _socket_name = socketPairPoll[socketIndex];
+								const auto& _socket = polledSockets[socketIndex];
 								auto req = _socket->receive();
-								if (_tcpCallbacks.contains(_socket_name)) {
-									auto[rangeBegin, rangeEnd] =
-									_tcpCallbacks.equal_range(_socket_name);
-									for (
-											auto callback = rangeBegin;
-											callback!=rangeEnd;
-											++callback) {
-										callback->second(_socket, req);
-									}
+								if (track_(_socket_name, req)) {
+									continue;
 								}
+								dispatch_(
+										_socket,
+										_socket_name,
+										std::move(req),
+										bindings[socketIndex],
+										_wakeup_);
 							}
 						}
+						sweep_(socketPairPoll);
+						if (polls.back().revents & ZMQ_POLLIN) {
+							_wakeup.drain();
+							for (auto &[socketName, socket] : sockets) {
+								socket->flush();
+							}
+						}
+					}
+					catch (const zmq::error_t& error) {
+						if (error.num()!=ETERM) {
+							logger::error("Error in listening on router sockets, what? {}",
+									error.what());
+						}
+					}
+					catch (const std::exception& error) {
+						logger::error("Error in listening on router sockets, what? {}",
+								error.what());
 					}
-					catch (...) { }
-					std::this_thread::sleep_for(2s);
+					catch (...) {
+						logger::error("Unknown error in listening on router sockets");
+					}
+				}
+				{
+					std::lock_guard lock{ _mutex };
+					std::erase(_wakeups, &_wakeup);
 				}
 			}
 		}
 	}
 
-	void router::
-	listen_on_ipc_() noexcept {
-		if (not listeningOnIpc_()) {
-			if (not _ipcSocket.empty()) {
-				bind_();
-				status_(routerStatus::listeningOnIpc);
-				std::vector<zmq::pollitem_t> polls;
-				std::vector<std::string> socketPairPoll;
-				for (auto &[socketName, socket] : _ipcSocket) {
-					polls.push_back(
-							zmq::pollitem_t{
-									static_cast<void*>(***socket),
-									0,
-									ZMQ_POLLIN,
-									0
-							}
-					);
-					socketPairPoll.push_back(socketName);
+	bool router::
+	embed_() noexcept {
+		if (_reactor) {
+			return true;
+		}
+		if (listening_() || listeningOnTcp_() || listeningOnIpc_() || listeningOnInproc_()) {
+			return false;
+		}
+		prepare_();
+		bind_();
+		_reactor = std::make_unique<reactor>();
+		_reactor->poller = busyPoller{ _busyPoll.spin };
+		embed_(_tcpSocket, _tcpCallbacks, _tcpRoutes, _reactor->tcp);
+		embed_(_ipcSocket, _ipcCallbacks, _ipcRoutes, _reactor->ipc);
+		embed_(_inprocSocket, _inprocCallbacks, _inprocRoutes, _reactor->inproc);
+		_reactor->polls.push_back(
+				zmq::pollitem_t{
+						nullptr,
+						_reactor->_wakeup->fd(),
+						ZMQ_POLLIN,
+						0
 				}
-				while (listeningOnIpc_()) {
-					try {
-						zmq::poll(polls);
-						int socketIndex{ -1 };
-						for (const auto& item : polls) {
-							++socketIndex;
-							if (item.revents==ZMQ_POLLIN) {
-								auto _socket_name = socketPairPoll[socketIndex];
-								auto _socket = _ipcSocket[_socket_name];
-								auto req = _socket->receive();
-								if (_ipcCallbacks.contains(_socket_name)) {
-									auto[rangeBegin, rangeEnd] =
-									_ipcCallbacks.equal_range(_socket_name);
-									for (
-											auto callback = rangeBegin;
-											callback!=rangeEnd;
-											++callback) {
-										callback->second(_socket, req);
-									}
-								}
-							}
-						}
+		);
+		std::lock_guard lock{ _mutex };
+		_wakeups.push_back(_reactor->_wakeup.get());
+		return true;
+	}
+
+	template<typename socket_t, typename callback_t>
+	void router::
+	embed_(
+			std::unordered_map<std::string, std::shared_ptr<socket_t>>& sockets,
+			const std::unordered_multimap<std::string, callback_t>& callbacks,
+			const std::unordered_map<std::string, routing<callback_t>>& routes,
+			polled<socket_t, callback_t>& _polled) {
+		for (auto &[socketName, socket] : sockets) {
+			_reactor->polls.push_back(
+					zmq::pollitem_t{
+							static_cast<void*>(***socket),
+							0,
+							ZMQ_POLLIN,
+							0
 					}
-					catch (...) { }
-					std::this_thread::sleep_for(2s);
+			);
+			_reactor->names.push_back(socketName);
+			_polled.names.push_back(socketName);
+			_polled.sockets.push_back(socket);
+			_polled.bindings.push_back(binding_(socketName, callbacks, routes));
+			socket->own([_wakeup = _reactor->_wakeup] {
+				_wakeup->notify();
+			});
+		}
+	}
+
+	template<typename socket_t, typename callback_t>
+	std::size_t router::
+	drain_(const polled<socket_t, callback_t>& _polled, const zmq::pollitem_t* polls) {
+		std::size_t dispatched{ 0 };
+		for (std::size_t socketIndex{ 0 };
+				socketIndex<_polled.sockets.size(); ++socketIndex) {
+			if (not (polls[socketIndex].revents & ZMQ_POLLIN)) {
+				continue;
+			}
+			const auto& _socket_name = _polled.names[socketIndex];
+			const auto& _socket = _polled.sockets[socketIndex];
+			// ZMQ_FD would not become readable again for the requests which
+			// are received already, so the socket is drained
+			do {
+				auto req = _socket->receive();
+				if (track_(_socket_name, req)) {
+					continue;
 				}
+				dispatch_(
+						_socket,
+						_socket_name,
+						std::move(req),
+						_polled.bindings[socketIndex],
+						_reactor->_wakeup);
+				++dispatched;
 			}
+			while (not paused_(_socket_name)
+					&& ((**_socket)->template getsockopt<int>(ZMQ_EVENTS) & ZMQ_POLLIN));
+		}
+		return dispatched;
+	}
+
+	template<typename callback_t>
+	std::shared_ptr<const router::binding<callback_t>> router::
+	binding_(
+			const std::string& name,
+			const std::unordered_multimap<std::string, callback_t>& callbacks,
+			const std::unordered_map<std::string, routing<callback_t>>& routes)
+	const noexcept {
+		auto _binding = std::make_shared<binding<callback_t>>();
+		auto[rangeBegin, rangeEnd] = callbacks.equal_range(name);
+		for (auto callback = rangeBegin; callback!=rangeEnd; ++callback) {
+			_binding->callbacks.push_back(callback->second);
+		}
+		if (const auto table = routes.find(name); table!=routes.end()) {
+			_binding->routes = &table->second;
+		}
+		if (const auto cached = _caches.find(name); cached!=_caches.end()) {
+			_binding->cache = cached->second.first;
+			_binding->key = cached->second.second;
+		}
+		if (const auto streamed = _streams.find(name); streamed!=_streams.end()) {
+			_binding->stream = streamed->second;
 		}
+		return _binding;
 	}
 
+	template<typename socket_t, typename callback_t>
 	void router::
-	listen_on_inproc_() noexcept {
-		if (not listeningOnInproc_()) {
-			if (not _inprocSocket.empty()) {
-				bind_();
-				status_(routerStatus::listeningOnInproc);
-				std::vector<zmq::pollitem_t> polls;
-				std::vector<std::string> socketPairPoll;
-				for (auto &[socketName, socket] : _inprocSocket) {
-					polls.push_back(
-							zmq::pollitem_t{
-									static_cast<void*>(***socket),
-									0,
-									ZMQ_POLLIN,
-									0
-							}
-					);
-					socketPairPoll.push_back(socketName);
+	dispatch_(
+			const std::shared_ptr<socket_t>& socket,
+			const std::string& name,
+			std::vector<std::string>&& req,
+			const std::shared_ptr<const binding<callback_t>>& _binding,
+			const std::shared_ptr<wakeup>& _wakeup)
+	noexcept {
+		if (req.empty()) {
+			return;
+		}
+		const auto identity = req.front();
+		// the header frame is consumed by the router itself
+		std::optional<deadline::clock::time_point> expiry;
+		// the request id, if any, is echoed on the replies
+		std::string replyHeader;
+		if (req.size()>2) {
+			const auto header = envelope::decode(req[2]);
+			if (header && header->packed) {
+				// each packed message is a request of its own
+				auto inner = *header;
+				inner.packed.reset();
+				inner.compressed.reset();
+				const auto innerHeader = envelope::encode(inner);
+				for (auto& message : envelope::unpack(req[1])) {
+					std::vector<std::string> single{ identity, std::move(message) };
+					if (not innerHeader.empty()) {
+						single.push_back(innerHeader);
+					}
+					dispatch_(socket, name, std::move(single), _binding, _wakeup);
 				}
-				while (listeningOnInproc_()) {
-					try {
-						zmq::poll(polls);
-						int socketIndex{ -1 };
-						for (const auto& item : polls) {
-							++socketIndex;
-							if (item.revents==ZMQ_POLLIN) {
-								auto _socket_name = socketPairPoll[socketIndex];
-								auto _socket = _inprocSocket[_socket_name];
-								auto req = _socket->receive();
-								if (_inprocCallbacks.contains(_socket_name)) {
-									auto[rangeBegin, rangeEnd] =
-									_inprocCallbacks.equal_range(_socket_name);
-									for (
-											auto callback = rangeBegin;
-											callback!=rangeEnd;
-											++callback) {
-										callback->second(_socket, req);
-									}
-								}
-							}
-						}
+				return;
+			}
+			if (header && header->stream && header->offset && header->total) {
+				// a chunk of a stream skips the cache, coalescing and
+				// admission, its credit bounds the chunks in flight instead
+				if (not _binding->stream) {
+					return;
+				}
+				auto run = [socket, _binding, identity, chunk = *header,
+						data = std::move(req[1])] {
+					_binding->stream(identity, streamChunk{
+							.stream = *chunk.stream,
+							.offset = *chunk.offset,
+							.total = *chunk.total,
+							.data = data });
+					envelope::header credit;
+					credit.stream = chunk.stream;
+					credit.credit = 1;
+					socket->send(identity, std::string{}, envelope::encode(credit));
+				};
+				if (_dispatcher) {
+					_dispatcher->dispatch(identity, std::move(run), name);
+				}
+				else {
+					run();
+				}
+				return;
+			}
+			if (header && header->budget) {
+				expiry = deadline::clock::now()
+						+std::chrono::milliseconds{ *header->budget };
+			}
+			if (header && header->request) {
+				envelope::header reply;
+				reply.request = header->request;
+				replyHeader = envelope::encode(reply);
+			}
+			req.resize(2);
+		}
+		if (expiry && *expiry<=deadline::clock::now()) {
+			++_expired;
+			return;
+		}
+		// replies sent to the client by the callbacks are kept for the
+		// response cache and the coalesced requests
+		std::shared_ptr<std::vector<std::string>> replies;
+		std::shared_ptr<responseCache> cache;
+		std::string cacheKey;
+		if (_binding->cache && req.size()>1) {
+			cache = _binding->cache;
+			cacheKey = _binding->key ? _binding->key(req[1]) : req[1];
+			if (auto hit = cache->lookup(cacheKey)) {
+				auto serve = [socket, identity, replyHeader, hit = std::move(hit)] {
+					for (const auto& reply : *hit) {
+						socket->send(identity, reply, replyHeader);
 					}
-					catch (...) { }
-					std::this_thread::sleep_for(2s);
+				};
+				if (_dispatcher) {
+					// served on the lane of the client, so its replies keep
+					// the order of its requests
+					_dispatcher->dispatch(identity, std::move(serve));
+				}
+				else {
+					serve();
+				}
+				return;
+			}
+			replies = std::make_shared<std::vector<std::string>>();
+		}
+		// admitted first, so a rejected or dropped request never leads
+		// identical requests which would be left without any reply
+		std::shared_ptr<void> ticket;
+		// router::limitInflight could replace it meanwhile
+		const auto admitting = _admission.load();
+		if (admitting) {
+			const auto policy = admitting->policy();
+			// the ticket could outlive the listening session which polls
+			// the socket, so it keeps the wakeup alive
+			auto [verdict, admitted] = admitting->offer(name,
+					[this](const std::string& group) {
+						return _dispatcher && _dispatcher->evictOldest(group);
+					},
+					[_wakeup, policy] {
+						if (policy==overloadPolicy::backpressure) {
+							// resume polling the paused socket
+							_wakeup->notify();
+						}
+					});
+			if (verdict==admission::verdict::rejected) {
+				socket->send(identity, admitting->busyReply(), replyHeader);
+				return;
+			}
+			if (verdict==admission::verdict::dropped) {
+				return;
+			}
+			ticket = std::move(admitted);
+		}
+		// identical requests in flight are held until the leader lands
+		std::shared_ptr<void> flight;
+		// whether the callbacks of the leader ran, otherwise its waiters
+		// get the busy reply instead of nothing
+		std::shared_ptr<bool> ran;
+		if (_coalescer.enabled(name) && req.size()>1) {
+			if (not _coalescer.join(name, req[1], identity, replyHeader)) {
+				return;
+			}
+			if (not replies) {
+				replies = std::make_shared<std::vector<std::string>>();
+			}
+			ran = std::make_shared<bool>(false);
+			// the flight lands once the leader is released, whether it is
+			// handled, expired or dropped
+			flight = _coalescer.flight(name, req[1], replies, ran,
+					admitting ? admitting->busyReply() : std::string{ "BUSY" },
+					[socket](const coalescer::waiter& waiter, const std::string& reply) {
+						socket->send(waiter.identity, reply, waiter.header);
+					});
+		}
+		auto run = [this, socket, req = std::move(req), _binding, ticket,
+				expiry, flight, ran, replies, cache, cacheKey, replyHeader] {
+			// the request could expire while it is queued on a lane
+			if (expiry && *expiry<=deadline::clock::now()) {
+				++_expired;
+				return;
+			}
+			const deadline scope{ expiry };
+			const agoNetwork::socket::correlation correlation{
+					req.front(),
+					replyHeader };
+			const agoNetwork::socket::observation observation{
+					replies
+					? agoNetwork::socket::observer{
+							[&req, &replies](
+									const std::string& address,
+									const std::string& message) {
+								if (address==req.front()) {
+									replies->push_back(message);
+								}
+							}}
+					: agoNetwork::socket::observer{}};
+			// the callbacks of the matching route, if any, run instead of
+			// the callbacks of the socket
+			const auto* routed = &_binding->callbacks;
+			if (_binding->routes && req.size()>1) {
+				if (const auto route = _binding->routes->trie.match(req[1])) {
+					routed = &_binding->routes->callbacks[*route];
+				}
+			}
+			for (const auto& callback : *routed) {
+				callback(socket, req);
+			}
+			if (cache && not replies->empty()) {
+				cache->store(cacheKey, *replies);
+			}
+			if (ran) {
+				*ran = true;
+			}
+		};
+		if (_dispatcher) {
+			// requests of a client always land on the same lane
+			_dispatcher->dispatch(identity, std::move(run), name);
+		}
+		else {
+			run();
+		}
+	}
+
+	bool router::
+	track_(const std::string& name, const std::vector<std::string>& req)
+	noexcept {
+		if (req.empty()) {
+			return false;
+		}
+		const auto tracking = _peers.find(name);
+		if (req.size()==1) {
+			// a notification carries the peer address alone
+			if (tracking!=_peers.end()) {
+				if (const auto known = tracking->second.table->toggle(req.front())) {
+					alive_(name, req.front(), *known);
+				}
+			}
+			return true;
+		}
+		if (tracking!=_peers.end()
+				&& tracking->second.table->touch(req.front())) {
+			alive_(name, req.front(), true);
+		}
+		return false;
+	}
+
+	long router::
+	pollTimeout_(const std::vector<std::string>& names) const noexcept {
+		long timeout{ -1 };
+		for (const auto& name : names) {
+			if (const auto tracking = _peers.find(name);
+					tracking!=_peers.end()) {
+				const auto half =
+						std::max<long>(tracking->second.ttl.count()/2, 1);
+				timeout = timeout<0 ? half : std::min(timeout, half);
+			}
+		}
+		return timeout;
+	}
+
+	void router::
+	sweep_(const std::vector<std::string>& names) noexcept {
+		const auto now = peerTable::clock::now();
+		for (const auto& name : names) {
+			if (const auto tracking = _peers.find(name);
+					tracking!=_peers.end()
+							&& now-tracking->second.sweep>=tracking->second.ttl/2) {
+				tracking->second.sweep = now;
+				for (const auto& identity
+						: tracking->second.table->evict(now-tracking->second.ttl)) {
+					alive_(name, identity, false);
 				}
 			}
 		}
 	}
 
+	void router::
+	alive_(const std::string& name, const std::string& identity, bool alive)
+	noexcept {
+		if (not alive) {
+			std::size_t purged{ 0 };
+			if (_dispatcher) {
+				purged += _dispatcher->evict(identity, name);
+			}
+			onSocket_(name, [&](const auto& socket) {
+				purged += socket->purge(identity);
+			});
+			_purged += purged;
+		}
+		if (const auto tracking = _peers.find(name);
+				tracking!=_peers.end() && tracking->second.onLiveness) {
+			try {
+				tracking->second.onLiveness(identity, alive);
+			}
+			catch (const std::exception& error) {
+				logger::warning("Error in the liveness callback of socket {}, what? {}",
+						name, error.what());
+			}
+			catch (...) {
+				logger::warning("Unknown error in the liveness callback of socket {}", name);
+			}
+		}
+	}
+
+	template<typename function_t>
+	bool router::
+	onSocket_(const std::string& name, function_t&& function) const noexcept {
+		if (const auto socket = _tcpSocket.find(name);
+				socket!=_tcpSocket.end()) {
+			function(socket->second);
+			return true;
+		}
+		if (const auto socket = _ipcSocket.find(name);
+				socket!=_ipcSocket.end()) {
+			function(socket->second);
+			return true;
+		}
+		if (const auto socket = _inprocSocket.find(name);
+				socket!=_inprocSocket.end()) {
+			function(socket->second);
+			return true;
+		}
+		return false;
+	}
+
+	void router::
+	listen_on_tcp_() noexcept {
+		listenOn_(
+				_tcpSocket,
+				_tcpCallbacks,
+				_tcpRoutes,
+				routerStatus::listeningOnTcp,
+				&router::listeningOnTcp_);
+	}
+
+	void router::
+	listen_on_ipc_() noexcept {
+		listenOn_(
+				_ipcSocket,
+				_ipcCallbacks,
+				_ipcRoutes,
+				routerStatus::listeningOnIpc,
+				&router::listeningOnIpc_);
+	}
+
+	void router::
+	listen_on_inproc_() noexcept {
+		listenOn_(
+				_inprocSocket,
+				_inprocCallbacks,
+				_inprocRoutes,
+				routerStatus::listeningOnInproc,
+				&router::listeningOnInproc_);
+	}
+
 	bool router::
 	validateURI_(const std::string& uri) const noexcept {
 		std::regex tcpAddress{
@@ -302,59 +743,64 @@ namespace agoNetwork {
 
 	void router::
 	status_(router::routerStatus&& status) noexcept {
-		switch (_status) {
+		// the listening threads of the protocols update it at once
+		auto current = _status.load();
+		while (not _status.compare_exchange_weak(current, next_(current, status))) { }
+	}
+
+	router::routerStatus router::
+	next_(routerStatus current, routerStatus status) noexcept {
+		switch (current) {
 		case routerStatus::initialized ... routerStatus::listening: {
-			_status = status;
-			break;
+			return status;
 		}
 		case routerStatus::listeningOnTcp: {
 			if (status==routerStatus::listeningOnIpc) {
-				_status = routerStatus::listeningOnTcpAndIpc;
+				return routerStatus::listeningOnTcpAndIpc;
 			}
 			else if (status==routerStatus::listeningOnInproc) {
-				_status = routerStatus::listeningOnTcpAndInproc;
+				return routerStatus::listeningOnTcpAndInproc;
 			}
-			break;
+			return current;
 		}
 		case routerStatus::listeningOnIpc: {
 			if (status==routerStatus::listeningOnTcp) {
-				_status = routerStatus::listeningOnTcpAndIpc;
+				return routerStatus::listeningOnTcpAndIpc;
 			}
 			else if (status==routerStatus::listeningOnInproc) {
-				_status = routerStatus::listeningOnIpcAndInproc;
+				return routerStatus::listeningOnIpcAndInproc;
 			}
-			break;
+			return current;
 		}
 		case routerStatus::listeningOnInproc: {
 			if (status==routerStatus::listeningOnTcp) {
-				_status = routerStatus::listeningOnTcpAndInproc;
+				return routerStatus::listeningOnTcpAndInproc;
 			}
 			else if (status==routerStatus::listeningOnIpc) {
-				_status = routerStatus::listeningOnIpcAndInproc;
+				return routerStatus::listeningOnIpcAndInproc;
 			}
-			break;
+			return current;
 		}
 		case routerStatus::listeningOnTcpAndIpc: {
 			if (status==routerStatus::listeningOnInproc) {
-				_status = routerStatus::listening;
+				return routerStatus::listening;
 			}
-			break;
+			return current;
 		}
 		case routerStatus::listeningOnTcpAndInproc: {
 			if (status==routerStatus::listeningOnIpc) {
-				_status = routerStatus::listening;
+				return routerStatus::listening;
 			}
-			break;
+			return current;
 		}
 		case routerStatus::listeningOnIpcAndInproc: {
 			if (status==routerStatus::listeningOnTcp) {
-				_status = routerStatus::listening;
+				return routerStatus::listening;
 			}
-			break;
+			return current;
 		}
 		default: {
-			_status = status;
-			break;
+			return status;
 		}
 		}
 	}
@@ -371,26 +817,32 @@ namespace agoNetwork {
 
 	bool router::
 	listeningOnTcp_() const noexcept {
+		const auto status = _status.load();
 		return
-				_status==routerStatus::listeningOnTcp
-						|| _status==routerStatus::listeningOnTcpAndIpc
-						|| _status==routerStatus::listeningOnTcpAndInproc;
+				status==routerStatus::listening
+						|| status==routerStatus::listeningOnTcp
+						|| status==routerStatus::listeningOnTcpAndIpc
+						|| status==routerStatus::listeningOnTcpAndInproc;
 	}
 
 	bool router::
 	listeningOnIpc_() const noexcept {
+		const auto status = _status.load();
 		return
-				_status==routerStatus::listeningOnIpc
-						|| _status==routerStatus::listeningOnTcpAndIpc
-						|| _status==routerStatus::listeningOnIpcAndInproc;
+				status==routerStatus::listening
+						|| status==routerStatus::listeningOnIpc
+						|| status==routerStatus::listeningOnTcpAndIpc
+						|| status==routerStatus::listeningOnIpcAndInproc;
 	}
 
 	bool router::
 	listeningOnInproc_() const noexcept {
+		const auto status = _status.load();
 		return
-				_status==routerStatus::listeningOnInproc
-						|| _status==routerStatus::listeningOnTcpAndInproc
-						|| _status==routerStatus::listeningOnIpcAndInproc;
+				status==routerStatus::listening
+						|| status==routerStatus::listeningOnInproc
+						|| status==routerStatus::listeningOnTcpAndInproc
+						|| status==routerStatus::listeningOnIpcAndInproc;
 	}
 
 	void router::
@@ -398,6 +850,101 @@ namespace agoNetwork {
 		listen_();
 	}
 
+	bool router::
+	paused_(const std::string& name) const noexcept {
+		const auto admitting = _admission.load();
+		return admitting && admitting->paused(name);
+	}
+
+	void router::
+	lanes(unsigned int lanes) noexcept {
+		_lanes = lanes;
+	}
+
+	void router::
+	limitInflight(
+			std::size_t perSocket,
+			std::size_t global,
+			overloadPolicy policy,
+			std::string busyReply) noexcept {
+		std::vector<std::string> sockets;
+		for (const auto &[socketName, socket] : _tcpSocket) {
+			sockets.push_back(socketName);
+		}
+		for (const auto &[socketName, socket] : _ipcSocket) {
+			sockets.push_back(socketName);
+		}
+		for (const auto &[socketName, socket] : _inprocSocket) {
+			sockets.push_back(socketName);
+		}
+		_admission = std::make_shared<admission>(
+				sockets,
+				perSocket,
+				global,
+				policy,
+				std::move(busyReply));
+	}
+
+	std::size_t router::
+	queueDepth(const std::string& name) const noexcept {
+		const auto admitting = _admission.load();
+		return admitting ? admitting->depth(name) : 0;
+	}
+
+	admission::statistics router::
+	overload() const noexcept {
+		const auto admitting = _admission.load();
+		return admitting ? admitting->stats() : admission::statistics{};
+	}
+
+	std::uint64_t router::
+	expired() const noexcept {
+		return _expired;
+	}
+
+	std::uint64_t router::
+	undecoded() const noexcept {
+		return _undecoded;
+	}
+
+	void router::
+	coalesce(const std::string& name) noexcept {
+		if (_tcpSocket.contains(name)
+				|| _ipcSocket.contains(name)
+				|| _inprocSocket.contains(name)) {
+			_coalescer.enable(name);
+		}
+	}
+
+	std::uint64_t router::
+	coalesced() const noexcept {
+		return _coalescer.coalesced();
+	}
+
+	void router::
+	cache(
+			const std::string& name,
+			std::chrono::milliseconds ttl,
+			std::size_t budget,
+			cacheKey key) noexcept {
+		if (_tcpSocket.contains(name)
+				|| _ipcSocket.contains(name)
+				|| _inprocSocket.contains(name)) {
+			_caches[name] = {
+					std::make_shared<responseCache>(ttl, budget),
+					std::move(key)
+			};
+		}
+	}
+
+	responseCache::statistics router::
+	cacheStatistics(const std::string& name) const noexcept {
+		const auto cached = _caches.find(name);
+		return cached==_caches.end()
+				? responseCache::statistics{}
+				: cached->second.first->stats();
+	}
+
 	void router::
 	registerCallback_(
 			const std::string& name,
@@ -433,4 +980,311 @@ namespace agoNetwork {
 			});
 		}
 	}
+
+	void router::
+	registerRoute_(
+			const std::string& name,
+			const std::string& route,
+			const router::tcp_callback& callback) noexcept {
+		if (_tcpSocket.contains(name)) {
+			auto& table = _tcpRoutes[name];
+			const auto index = table.trie.insert(route);
+			if (index>=table.callbacks.size()) {
+				table.callbacks.resize(index+1);
+			}
+			table.callbacks[index].push_back(callback);
+		}
+	}
+
+	void router::
+	registerRoute_(
+			const std::string& name,
+			const std::string& route,
+			const router::ipc_callback& callback) noexcept {
+		if (_ipcSocket.contains(name)) {
+			auto& table = _ipcRoutes[name];
+			const auto index = table.trie.insert(route);
+			if (index>=table.callbacks.size()) {
+				table.callbacks.resize(index+1);
+			}
+			table.callbacks[index].push_back(callback);
+		}
+	}
+
+	void router::
+	registerRoute_(
+			const std::string& name,
+			const std::string& route,
+			const router::inproc_callback& callback) noexcept {
+		if (_inprocSocket.contains(name)) {
+			auto& table = _inprocRoutes[name];
+			const auto index = table.trie.insert(route);
+			if (index>=table.callbacks.size()) {
+				table.callbacks.resize(index+1);
+			}
+			table.callbacks[index].push_back(callback);
+		}
+	}
+
+	void router::
+	trackPeers(
+			const std::string& name,
+			std::chrono::milliseconds ttl,
+			liveness onLiveness) noexcept {
+		onSocket_(name, [&](const auto& socket) {
+#ifdef ZMQ_ROUTER_NOTIFY
+			// connects and disconnects are received as the peer address alone
+			try {
+				(**socket)->setsockopt(
+						ZMQ_ROUTER_NOTIFY,
+						ZMQ_NOTIFY_CONNECT | ZMQ_NOTIFY_DISCONNECT);
+			}
+			catch (zmq::error_t&) { }
+#endif
+			_peers[name] = peerTracking{
+					std::make_unique<peerTable>(),
+					ttl,
+					peerTable::clock::now(),
+					std::move(onLiveness)
+			};
+		});
+	}
+
+	std::uint64_t router::
+	purged() const noexcept {
+		return _purged;
+	}
+
+	bool router::
+	push(
+			const std::string& name,
+			const std::string& identity,
+			const std::string& message) noexcept {
+		const auto tracking = _peers.find(name);
+		if (tracking==_peers.end()
+				|| not tracking->second.table->pushed(identity)) {
+			return false;
+		}
+		// sends from the other threads are flushed by the listening thread
+		return onSocket_(name, [&](const auto& socket) {
+			socket->send(identity, message);
+		});
+	}
+
+	std::size_t router::
+	broadcast(const std::string& name, const std::string& message) noexcept {
+		std::size_t pushed{ 0 };
+		for (const auto& identity : peers(name)) {
+			if (push(name, identity, message)) {
+				++pushed;
+			}
+		}
+		return pushed;
+	}
+
+	std::vector<std::string> router::
+	peers(const std::string& name) const noexcept {
+		const auto tracking = _peers.find(name);
+		return tracking==_peers.end()
+				? std::vector<std::string>{}
+				: tracking->second.table->identities();
+	}
+
+	std::optional<peerTable::peer> router::
+	peer(const std::string& name, const std::string& identity) const noexcept {
+		const auto tracking = _peers.find(name);
+		return tracking==_peers.end()
+				? std::nullopt
+				: tracking->second.table->find(identity);
+	}
+
+	void router::
+	registerStream(const std::string& name, streamCallback callback) noexcept {
+		if (onSocket_(name, [](const auto&) { })) {
+			_streams[name] = std::move(callback);
+		}
+	}
+
+	bool router::
+	receive(
+			const std::string& name,
+			frameBuffer& buffer,
+			std::chrono::milliseconds timeout) noexcept {
+		bind_();
+		const auto until = std::chrono::steady_clock::now()+timeout;
+		bool received{ false };
+		onSocket_(name, [&](const auto& socket) {
+			zmq::pollitem_t poll{ static_cast<void*>(***socket), 0, ZMQ_POLLIN, 0 };
+			while (not received) {
+				const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+						until-std::chrono::steady_clock::now());
+				if (left.count()<0) {
+					return;
+				}
+				try {
+					zmq::poll(&poll, 1, left.count());
+				}
+				catch (zmq::error_t& error) {
+					logger::error("Error in polling socket {}, what? {}", name, error.what());
+					return;
+				}
+				if (poll.revents & ZMQ_POLLIN) {
+					// a notification carries the peer address alone
+					received = socket->receive(buffer) && buffer.size()>1;
+				}
+			}
+		});
+		return received;
+	}
+
+	bool router::
+	compress(const std::string& name, compressionOptions options) noexcept {
+		const auto _compressor = std::make_shared<compressor>(std::move(options));
+		return onSocket_(name, [&](const auto& socket) {
+			socket->compress(_compressor);
+		});
+	}
+
+	std::optional<compressor::statistics> router::
+	compression(const std::string& name) const noexcept {
+		std::shared_ptr<compressor> _compressor;
+		onSocket_(name, [&](const auto& socket) {
+			_compressor = socket->compression();
+		});
+		if (not _compressor) {
+			return std::nullopt;
+		}
+		return _compressor->stats();
+	}
+
+	std::vector<int> router::
+	descriptors() noexcept {
+		std::vector<int> fds;
+		if (not embed_()) {
+			return fds;
+		}
+		try {
+			auto add = [&fds](const auto& sockets) {
+				for (const auto& socket : sockets) {
+					fds.push_back((**socket)->template getsockopt<int>(ZMQ_FD));
+				}
+			};
+			add(_reactor->tcp.sockets);
+			add(_reactor->ipc.sockets);
+			add(_reactor->inproc.sockets);
+		}
+		catch (zmq::error_t& error) {
+			logger::error("Error in getting the descriptors of router sockets, what? {}",
+					error.what());
+		}
+		fds.push_back(_reactor->_wakeup->fd());
+		return fds;
+	}
+
+	int router::
+	events(const std::string& name) const noexcept {
+		int events{ 0 };
+		onSocket_(name, [&](const auto& socket) {
+			try {
+				events = (**socket)->template getsockopt<int>(ZMQ_EVENTS);
+			}
+			catch (zmq::error_t& error) {
+				logger::error("Error in getting the events of socket {}, what? {}",
+						name, error.what());
+			}
+		});
+		return events;
+	}
+
+	std::size_t router::
+	pollOnce(std::chrono::milliseconds timeout) noexcept {
+		if (not embed_()) {
+			return 0;
+		}
+		auto& _reactor_ = *_reactor;
+		std::size_t dispatched{ 0 };
+		try {
+			for (std::size_t socketIndex{ 0 };
+					socketIndex<_reactor_.names.size(); ++socketIndex) {
+				_reactor_.polls[socketIndex].events =
+						paused_(_reactor_.names[socketIndex]) ? 0 : ZMQ_POLLIN;
+			}
+			// wake up in time in order to evict the dead peers
+			auto pollTimeout = pollTimeout_(_reactor_.names);
+			if (timeout.count()>=0 && (pollTimeout<0 || timeout.count()<pollTimeout)) {
+				pollTimeout = timeout.count();
+			}
+			_reactor_.poller.poll(_reactor_.polls, pollTimeout);
+			if (_reactor_.polls.back().revents & ZMQ_POLLIN) {
+				_reactor_._wakeup->drain();
+				for (const auto& socket : _reactor_.tcp.sockets) {
+					socket->flush();
+				}
+				for (const auto& socket : _reactor_.ipc.sockets) {
+					socket->flush();
+				}
+				for (const auto& socket : _reactor_.inproc.sockets) {
+					socket->flush();
+				}
+			}
+			const auto* polls = _reactor_.polls.data();
+			dispatched += drain_(_reactor_.tcp, polls);
+			polls += _reactor_.tcp.sockets.size();
+			dispatched += drain_(_reactor_.ipc, polls);
+			polls += _reactor_.ipc.sockets.size();
+			dispatched += drain_(_reactor_.inproc, polls);
+			sweep_(_reactor_.names);
+		}
+		catch (const zmq::error_t& error) {
+			if (error.num()!=ETERM) {
+				logger::error("Error in polling router sockets, what? {}", error.what());
+			}
+		}
+		catch (const std::exception& error) {
+			logger::error("Error in polling router sockets, what? {}", error.what());
+		}
+		catch (...) {
+			logger::error("Unknown error in polling router sockets");
+		}
+		return dispatched;
+	}
+
+	std::size_t router::
+	runFor(std::chrono::milliseconds duration) noexcept {
+		if (not embed_()) {
+			return 0;
+		}
+		const auto until = std::chrono::steady_clock::now()+duration;
+		std::size_t dispatched{ 0 };
+		// a stop which comes before the call is not lost, it is consumed
+		// once the loop returns
+		while (not _stopping.exchange(false)) {
+			const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+					until-std::chrono::steady_clock::now());
+			if (left.count()<=0) {
+				break;
+			}
+			dispatched += pollOnce(left);
+		}
+		return dispatched;
+	}
+
+	void router::
+	busyPoll(busyPollOptions options) noexcept {
+		_busyPoll = std::move(options);
+	}
+
+	void router::
+	placeOn(const numaNode& node) noexcept {
+		_node = node;
+	}
+
+	void router::
+	stop() noexcept {
+		_stopping = true;
+		std::lock_guard lock{ _mutex };
+		for (const auto* _wakeup : _wakeups) {
+			_wakeup->notify();
+		}
+	}
 }
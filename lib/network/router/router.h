@@ -8,16 +8,35 @@
 #ifndef AGO_NETWORK_LIBRARY_H
 #define AGO_NETWORK_LIBRARY_H
 
-#include <iostream>
 #include <lib/concepts/concepts.h>
 #include <lib/network/socket/socket.h>
 #include <lib/network/zmq/zmqContext.h>
+#include <lib/network/dispatcher/dispatcher.h>
+#include <lib/network/admission/admission.h>
+#include <lib/network/wakeup/wakeup.h>
+#include <lib/network/deadline/deadline.h>
+#include <lib/network/envelope/envelope.h>
+#include <lib/network/coalescer/coalescer.h>
+#include <lib/network/cache/responseCache.h>
+#include <lib/network/peers/peerTable.h>
+#include <lib/network/codec/codec.h>
+#include <lib/network/routing/routeTrie.h>
+#include <lib/network/stream/stream.h>
+#include <lib/network/poller/busyPoller.h>
+#include <lib/network/numa/numaNode.h>
+#include <lib/network/log/logger.h>
 #include <map>
 
 namespace agoNetwork {
 	/// @brief **router** is the *zmq router* adapter
 	/// which brings communication functionality.
 	class router final : private zmqContext {
+	public: // public data
+		/// @brief liveness is a function alias which gets the identity of a
+		/// peer and whether it is alive (connected or heard of) or dead
+		/// (disconnected or not heard of for its time to live).
+		using liveness = std::function<void(const std::string&, bool)>;
+
 	private: // private data
 		/// Maps socket name to a tcpSocket shared pointer.
 		std::unordered_map
@@ -55,6 +74,108 @@ namespace agoNetwork {
 		std::unordered_multimap<std::string, ipc_callback> _ipcCallbacks;
 		/// Maps socket name to inproc_callback.
 		std::unordered_multimap<std::string, inproc_callback> _inprocCallbacks;
+		/// @brief Routes of a socket and the callbacks of each route.
+		template<typename callback_t>
+		struct routing {
+			routeTrie trie;
+			/// The callbacks by route index.
+			std::vector<std::vector<callback_t>> callbacks;
+		};
+		/// Maps socket name to its routes of tcp_callback.
+		std::unordered_map<std::string, routing<tcp_callback>> _tcpRoutes;
+		/// Maps socket name to its routes of ipc_callback.
+		std::unordered_map<std::string, routing<ipc_callback>> _ipcRoutes;
+		/// Maps socket name to its routes of inproc_callback.
+		std::unordered_map<std::string, routing<inproc_callback>> _inprocRoutes;
+		/// Number of the worker lanes which run the callbacks.
+		/// Zero means the callbacks run on the listening threads.
+		unsigned int _lanes{ 0 };
+		/// Runs the callbacks on the worker lanes by client identity.
+		std::unique_ptr<dispatcher> _dispatcher;
+		/// Bounds the inflight requests, no admission means unbounded.
+		/// It could be replaced while listening, the listening threads and
+		/// the tickets of the inflight requests keep their own alive.
+		std::atomic<std::shared_ptr<admission>> _admission;
+		/// Number of the requests which are dropped since their deadline
+		/// is passed before their callbacks run.
+		std::atomic<std::uint64_t> _expired{ 0 };
+		/// Number of the requests of typed callbacks which their codec
+		/// could not decode.
+		std::atomic<std::uint64_t> _undecoded{ 0 };
+		/// Holds identical requests of the coalescing sockets in flight.
+		coalescer _coalescer;
+		/// cacheKey is a function alias which maps a request message to
+		/// its response cache key.
+		using cacheKey = std::function<std::string(const std::string&)>;
+		/// Maps socket name to its response cache and cache key.
+		/// An empty cache key means the whole message is the key.
+		std::unordered_map<
+				std::string,
+				std::pair<std::shared_ptr<responseCache>, cacheKey>> _caches;
+		/// @brief Peers of a socket and how long they live unheard of.
+		struct peerTracking {
+			std::unique_ptr<peerTable> table;
+			std::chrono::milliseconds ttl;
+			/// The last time the dead peers are evicted.
+			peerTable::clock::time_point sweep;
+			/// Called once a peer becomes alive or dead.
+			liveness onLiveness;
+		};
+		/// Maps socket name to its tracked peers.
+		std::unordered_map<std::string, peerTracking> _peers;
+		/// Maps socket name to its stream callback.
+		std::unordered_map<std::string, streamCallback> _streams;
+		/// @brief What a request of a socket needs, resolved once the
+		/// socket starts listening so requests never look it up by name.
+		template<typename callback_t>
+		struct binding {
+			/// The callbacks registered by router::registerCallback.
+			std::vector<callback_t> callbacks;
+			/// The routes of the socket, if any.
+			const routing<callback_t>* routes{ nullptr };
+			/// The response cache of the socket, if any.
+			std::shared_ptr<responseCache> cache;
+			cacheKey key;
+			/// The stream callback of the socket, if any.
+			streamCallback stream;
+		};
+		/// Number of the queued requests and replies which are dropped
+		/// since their peer is dead.
+		std::atomic<std::uint64_t> _purged{ 0 };
+		/// @brief The sockets of a protocol which the embedded reactor
+		/// polls, in the order of their poll items.
+		template<typename socket_t, typename callback_t>
+		struct polled {
+			std::vector<std::string> names;
+			std::vector<std::shared_ptr<socket_t>> sockets;
+			std::vector<std::shared_ptr<const binding<callback_t>>> bindings;
+		};
+		/// @brief What the embedded reactor polls, see router::pollOnce.
+		struct reactor {
+			/// Shared with the outboxes of the sockets, so other threads
+			/// never notify a destroyed wakeup.
+			std::shared_ptr<wakeup> _wakeup{ std::make_shared<wakeup>() };
+			polled<tcpSocket, tcp_callback> tcp;
+			polled<ipcSocket, ipc_callback> ipc;
+			polled<inprocSocket, inproc_callback> inproc;
+			/// Names of all the polled sockets.
+			std::vector<std::string> names;
+			/// The poll items of the sockets and the wakeup (the last one).
+			std::vector<zmq::pollitem_t> polls;
+			busyPoller poller;
+		};
+		/// The embedded reactor, created by the first router::pollOnce.
+		std::unique_ptr<reactor> _reactor;
+		/// How the listening threads spin before they block.
+		busyPollOptions _busyPoll;
+		/// The NUMA node of the listening threads and the worker lanes.
+		std::optional<numaNode> _node;
+		/// Makes the listening threads and the embedded reactor return.
+		std::atomic<bool> _stopping{ false };
+		/// Guards router::_wakeups.
+		std::mutex _mutex;
+		/// The wakeups of the running poll loops, notified by router::stop.
+		std::vector<const wakeup*> _wakeups;
 
 	private: // status
 		/// Represents router status.
@@ -68,9 +189,11 @@ namespace agoNetwork {
 			listeningOnTcpAndIpc,
 			listeningOnTcpAndInproc,
 			listeningOnIpcAndInproc,
-		} _status{ routerStatus::initialized };
+		};
+		/// The listening threads, router::stop and the callers of
+		/// router::pollOnce read and update it at once.
+		std::atomic<routerStatus> _status{ routerStatus::initialized };
 
-	public: // public data
 	public: // constructors and destructors
 		/// @brief Registers sockets.
 		/// The router constructor simply calls the
@@ -88,6 +211,23 @@ namespace agoNetwork {
 			(registerSocket_(_context, socket), ...);
 		}
 
+		/// @brief Registers sockets on a shared context, e.g. the context of
+		/// a NUMA node (see agoNetwork::numaNode::context).
+		/// @note inproc sockets must share the context with their pairs.
+		/// @param context is the shared zmq context.
+		/// @param socket is socket_t parameter pack.
+		template<Socket... socket_t>
+		explicit
+		router(std::shared_ptr<zmq::context_t> context, socket_t... socket)
+		noexcept
+				:zmqContext{ std::move(context) } {
+			(registerSocket_(_context, socket), ...);
+		}
+
+		/// @brief Join the worker lanes before anything else is destroyed,
+		/// the tasks left on them still use the other members.
+		~router();
+
 	private:
 		/// @brief Registers tcp sockets in router::_tcpSocket.
 		/// @warning This function could throw a runtime error if the specified
@@ -119,6 +259,27 @@ namespace agoNetwork {
 		void
 		registerCallback_(const std::string&, const inproc_callback&) noexcept;
 
+		/// @brief Registers router::tcp_callback in router::_tcpRoutes.
+		void
+		registerRoute_(
+				const std::string&,
+				const std::string&,
+				const tcp_callback&) noexcept;
+
+		/// @brief Registers router::ipc_callback in router::_ipcRoutes.
+		void
+		registerRoute_(
+				const std::string&,
+				const std::string&,
+				const ipc_callback&) noexcept;
+
+		/// @brief Registers router::inproc_callback in router::_inprocRoutes.
+		void
+		registerRoute_(
+				const std::string&,
+				const std::string&,
+				const inproc_callback&) noexcept;
+
 	public:
 		/// @brief Registers callbacks.
 		/// @tparam routerCallback_ is ::routerCallback concept which is
@@ -140,16 +301,208 @@ namespace agoNetwork {
 			(registerCallback_(name, callback_), ...);
 		}
 
+		/// @brief Registers callbacks of a route, i.e. a topic prefix or a
+		/// leading type id (see agoNetwork::typeRoute) of the messages.
+		/// A request runs the callbacks of the longest route which prefixes
+		/// its message, the callbacks registered by
+		/// router::registerCallback run only if no route matches.
+		/// The message is passed as it is, the route is not stripped.
+		/// @note It should be called before router::listen, the routes are
+		/// packed into a radix trie once the router starts listening.
+		/// @param name Name of the registered socket
+		/// @param route The topic prefix or type id
+		/// @param callback_ Invocable object like a lambda
+		template<routerCallback... routerCallback_>
+		void
+		registerRoute(
+				const std::string& name,
+				const std::string& route,
+				const routerCallback_& ... callback_)
+		noexcept {
+			(registerRoute_(name, route, callback_), ...);
+		}
+
+		/// @brief Registers a callback typed on a message.
+		/// The request message is decoded by the codec before the callback
+		/// runs, requests which could not be decoded never reach it (see
+		/// router::undecoded).
+		/// Replies could be encoded by agoNetwork::encoded.
+		/// @tparam message_t The message type
+		/// @tparam codec_t is ::messageCodec concept of the message,
+		/// agoNetwork::fixedCodec by default, see agoNetwork::varintCodec.
+		/// @tparam callback_t is ::typedCallback concept which is
+		/// a function that its parameters are
+		/// - agoNetwork::socket shared pointer (tcp, ipc or inproc)
+		/// - the client address
+		/// - the decoded message
+		/// @param name Name of the registered socket
+		/// @param callback_ Invocable object like a lambda
+		template<
+				typename message_t,
+				typename codec_t = fixedCodec<message_t>,
+				typename callback_t>
+		requires messageCodec<codec_t, message_t>
+				&& typedCallback<callback_t, message_t>
+		void
+		registerCallback(const std::string& name, callback_t callback_)
+		noexcept {
+			if constexpr (std::is_invocable_v<callback_t,
+					const std::shared_ptr<tcpSocket>&,
+					const std::string&,
+					const message_t&>) {
+				registerCallback_(name,
+						tcp_callback{ typed_<message_t, codec_t>(callback_) });
+			}
+			if constexpr (std::is_invocable_v<callback_t,
+					const std::shared_ptr<ipcSocket>&,
+					const std::string&,
+					const message_t&>) {
+				registerCallback_(name,
+						ipc_callback{ typed_<message_t, codec_t>(callback_) });
+			}
+			if constexpr (std::is_invocable_v<callback_t,
+					const std::shared_ptr<inprocSocket>&,
+					const std::string&,
+					const message_t&>) {
+				registerCallback_(name,
+						inproc_callback{ typed_<message_t, codec_t>(callback_) });
+			}
+		}
+
+	private:
+		/// @brief Wrap a typed callback into a callback of the raw request.
+		/// A request which could not be decoded is counted and logged, see
+		/// router::undecoded.
+		template<typename message_t, typename codec_t, typename callback_t>
+		auto
+		typed_(callback_t callback_) noexcept {
+			return [this, callback_](
+					const auto& socket,
+					const std::vector<std::string>& req) {
+				if (req.size()>1) {
+					if (const auto message = codec_t::decode(req[1])) {
+						callback_(socket, req.front(), *message);
+						return;
+					}
+				}
+				++_undecoded;
+				logger::warning("Error in decoding a request of socket {}, {} bytes",
+						socket->name(), req.size()>1 ? req[1].size() : 0);
+			};
+		}
+
 	private: // private methods
 		/// @brief Make all the registered sockets bind to their address.
 		void
 		bind_() noexcept;
 
+		/// @brief Start the worker lanes and pack the routes, once the
+		/// router starts listening.
+		void
+		prepare_() noexcept;
+
 		/// @brief Perform listening on all the registered sockets and call the
 		/// corresponded callbacks.
 		void
 		listen_() noexcept;
 
+		/// @brief Perform listening on the specified sockets and call the
+		/// corresponded callbacks while the specified status check holds.
+		template<typename socket_t, typename callback_t>
+		void
+		listenOn_(
+				std::unordered_map<std::string, std::shared_ptr<socket_t>>&,
+				const std::unordered_multimap<std::string, callback_t>&,
+				const std::unordered_map<std::string, routing<callback_t>>&,
+				routerStatus&&,
+				bool (router::*)() const noexcept) noexcept;
+
+		/// @brief Create the embedded reactor unless the router is listening
+		/// on its own threads.
+		/// @return true if the reactor is there and false otherwise.
+		bool
+		embed_() noexcept;
+
+		/// @brief Add the specified sockets to the embedded reactor and make
+		/// the calling thread their owner.
+		template<typename socket_t, typename callback_t>
+		void
+		embed_(
+				std::unordered_map<std::string, std::shared_ptr<socket_t>>&,
+				const std::unordered_multimap<std::string, callback_t>&,
+				const std::unordered_map<std::string, routing<callback_t>>&,
+				polled<socket_t, callback_t>&);
+
+		/// @brief Receive and dispatch the requests of the polled sockets
+		/// which are readable, until each of them has nothing to receive.
+		/// @return Number of the dispatched requests.
+		template<typename socket_t, typename callback_t>
+		std::size_t
+		drain_(const polled<socket_t, callback_t>&, const zmq::pollitem_t*);
+
+		/// @brief Resolve the callbacks, routes and cache of a socket.
+		template<typename callback_t>
+		[[nodiscard]]
+		std::shared_ptr<const binding<callback_t>>
+		binding_(
+				const std::string&,
+				const std::unordered_multimap<std::string, callback_t>&,
+				const std::unordered_map<std::string, routing<callback_t>>&)
+		const noexcept;
+
+		/// @brief Admit a received request and run its callbacks either
+		/// inline or on the worker lane of the client identity.
+		/// A packed request is split and each of its messages is dispatched
+		/// as a request of its own.
+		/// The wakeup is notified once a request of a paused socket is
+		/// released.
+		template<typename socket_t, typename callback_t>
+		void
+		dispatch_(
+				const std::shared_ptr<socket_t>&,
+				const std::string&,
+				std::vector<std::string>&&,
+				const std::shared_ptr<const binding<callback_t>>&,
+				const std::shared_ptr<wakeup>&)
+		noexcept;
+
+		/// @brief Record a received request in the peer table of the socket.
+		/// @return true if the request is a connect or disconnect
+		/// notification which should not reach the callbacks.
+		bool
+		track_(const std::string&, const std::vector<std::string>&) noexcept;
+
+		/// @brief Specify the poll timeout of the specified sockets so the
+		/// dead peers are evicted in time.
+		/// @return Half of the shortest peer time to live or -1 (no timeout)
+		/// if no peer is tracked.
+		[[nodiscard]]
+		long
+		pollTimeout_(const std::vector<std::string>&) const noexcept;
+
+		/// @brief Evict the dead peers of the specified sockets.
+		void
+		sweep_(const std::vector<std::string>&) noexcept;
+
+		/// @brief Tell the liveness of a peer of the specified socket,
+		/// the queued requests and replies of a dead peer are dropped.
+		void
+		alive_(const std::string&, const std::string&, bool) noexcept;
+
+		/// @brief Run the function on the registered socket of the specified
+		/// name, whichever its protocol is.
+		/// @return true if the socket is registered and false otherwise.
+		template<typename function_t>
+		bool
+		onSocket_(const std::string&, function_t&&) const noexcept;
+
+		/// @brief Specify whether polling the socket is paused
+		/// by the backpressure policy.
+		/// @return true if the socket should not be polled.
+		[[nodiscard]]
+		bool
+		paused_(const std::string&) const noexcept;
+
 		/// @brief Perform listening on all the registered tcp sockets and call
 		/// the corresponded callbacks.
 		void
@@ -177,6 +530,12 @@ namespace agoNetwork {
 		void
 		status_(routerStatus&&) noexcept;
 
+		/// @brief Specify the status which follows the current one once a
+		/// protocol starts listening.
+		[[nodiscard]]
+		static routerStatus
+		next_(routerStatus, routerStatus) noexcept;
+
 		/// @brief Specify whether the router is bound.
 		/// @return true if the router is bound and false otherwise.
 		[[nodiscard]]
@@ -211,6 +570,292 @@ namespace agoNetwork {
 		/// @brief Make all the sockets start listening.
 		void
 		listen() noexcept;
+
+		/// @brief Run the callbacks on the specified number of worker lanes.
+		/// The client identity (the first element of the request) picks the
+		/// lane, so requests of a client are handled strictly in order while
+		/// different clients are handled in parallel.
+		/// Replies sent from the lanes are flushed by the listening threads.
+		/// @note It should be called before router::listen, zero (default)
+		/// runs the callbacks on the listening threads.
+		void
+		lanes(unsigned int) noexcept;
+
+		/// @brief Bound the inflight requests (received but not handled yet).
+		/// The requests beyond the limits are handled by the policy:
+		/// - agoNetwork::overloadPolicy::reject replies the busy message
+		/// - agoNetwork::overloadPolicy::dropOldest drops the oldest queued
+		/// request of the socket (or of any socket if the global limit is
+		/// reached), the new one is dropped if nothing is queued
+		/// - agoNetwork::overloadPolicy::backpressure stops polling the
+		/// socket until its requests are released
+		/// @note It could be called while listening, the inflight requests
+		/// are then counted by the previous limits until they are released.
+		/// The requests only queue up on the worker lanes, see router::lanes.
+		/// @param perSocket Limit of each socket, zero means unbounded.
+		/// @param global Limit of all sockets, zero means unbounded.
+		/// @param policy What happens to the requests beyond the limits.
+		/// @param busyReply The reply of the rejected requests.
+		void
+		limitInflight(
+				std::size_t perSocket,
+				std::size_t global,
+				overloadPolicy policy = overloadPolicy::reject,
+				std::string busyReply = "BUSY") noexcept;
+
+		/// @brief Specify the number of the inflight requests of a socket.
+		/// @param name Name of the registered socket
+		[[nodiscard]]
+		std::size_t
+		queueDepth(const std::string& name) const noexcept;
+
+		/// @brief Specify the inflight, rejected and dropped requests.
+		[[nodiscard]]
+		admission::statistics
+		overload() const noexcept;
+
+		/// @brief Specify the number of the expired requests.
+		/// Requests carry the remaining budget of their dealers, expired
+		/// ones are dropped before their callbacks run. Callbacks could
+		/// query the remaining budget by agoNetwork::deadline::remaining.
+		[[nodiscard]]
+		std::uint64_t
+		expired() const noexcept;
+
+		/// @brief Specify the number of the requests which the codec of
+		/// their typed callbacks could not decode, e.g. since the peers do
+		/// not share the schema. They never reach the callbacks and are not
+		/// replied.
+		/// @see router::registerCallback
+		[[nodiscard]]
+		std::uint64_t
+		undecoded() const noexcept;
+
+		/// @brief Make the specified socket coalesce identical requests.
+		/// A request whose payload matches a request in flight on the same
+		/// socket never runs the callbacks, it receives the replies which
+		/// the callbacks of the first request send to its client instead.
+		/// @note Only replies sent while the callbacks run are fanned out.
+		/// @param name Name of the registered socket
+		void
+		coalesce(const std::string& name) noexcept;
+
+		/// @brief Specify the number of the coalesced requests.
+		[[nodiscard]]
+		std::uint64_t
+		coalesced() const noexcept;
+
+		/// @brief Put a response cache in front of the callbacks of the
+		/// specified socket.
+		/// The replies which the callbacks send to the client are kept for
+		/// the time to live, identical requests are then replied by the
+		/// listening thread without running the callbacks.
+		/// @note It should be called before router::listen.
+		/// @param name Name of the registered socket
+		/// @param ttl Time to live of the replies
+		/// @param budget Maximum number of the bytes held by the cache
+		/// @param key Maps a request message to its cache key,
+		/// the whole message is the key by default
+		void
+		cache(
+				const std::string& name,
+				std::chrono::milliseconds ttl,
+				std::size_t budget,
+				cacheKey key = {}) noexcept;
+
+		/// @brief Specify the hits, misses and evictions of the response
+		/// cache of the specified socket.
+		/// @param name Name of the registered socket
+		[[nodiscard]]
+		responseCache::statistics
+		cacheStatistics(const std::string& name) const noexcept;
+
+		/// @brief Keep track of the peers of the specified socket.
+		/// A peer is known once it connects (if ZMQ_ROUTER_NOTIFY is
+		/// available) or sends anything, every message (a heartbeat as well)
+		/// keeps it alive and it is evicted once it disconnects or is not
+		/// heard of for the time to live.
+		/// Once a peer is dead its requests queued on the worker lanes and
+		/// its replies queued by the other threads are dropped.
+		/// @note It should be called before router::listen. The liveness
+		/// callback is called by the listening thread. Configure the socket
+		/// heartbeats (see agoNetwork::socketModel::heartbeat) in order to
+		/// have half-open connections closed as well.
+		/// @param name Name of the registered socket
+		/// @param ttl How long a peer lives without being heard of
+		/// @param onLiveness Called once a peer becomes alive or dead
+		void
+		trackPeers(
+				const std::string& name,
+				std::chrono::milliseconds ttl,
+				liveness onLiveness = {}) noexcept;
+
+		/// @brief Specify the number of the queued requests and replies
+		/// which are dropped since their peer is dead.
+		[[nodiscard]]
+		std::uint64_t
+		purged() const noexcept;
+
+		/// @brief Push a message to a known peer of the specified socket,
+		/// without a request of the peer.
+		/// @note It could be called from any thread while listening.
+		/// @param name Name of the registered socket
+		/// @param identity The peer address, see router::peers
+		/// @param message The pushed message
+		/// @return true if the peer is known and false otherwise.
+		bool
+		push(
+				const std::string& name,
+				const std::string& identity,
+				const std::string& message) noexcept;
+
+		/// @brief Push a message to all the known peers of the specified
+		/// socket.
+		/// @param name Name of the registered socket
+		/// @param message The pushed message
+		/// @return Number of the peers which the message is pushed to.
+		std::size_t
+		broadcast(const std::string& name, const std::string& message)
+		noexcept;
+
+		/// @brief Specify the identities of the known peers of the specified
+		/// socket.
+		/// @param name Name of the registered socket
+		[[nodiscard]]
+		std::vector<std::string>
+		peers(const std::string& name) const noexcept;
+
+		/// @brief Specify the last seen time and the counters of a known peer.
+		/// @param name Name of the registered socket
+		/// @param identity The peer address
+		/// @return The peer or nothing if it is unknown.
+		[[nodiscard]]
+		std::optional<peerTable::peer>
+		peer(const std::string& name, const std::string& identity)
+		const noexcept;
+
+		/// @brief Registers the callback of the streams of a socket.
+		/// The chunks of a stream (see dealer::stream) are handed to the
+		/// callback in order as they arrive, on the worker lane of the client
+		/// if any. Once the callback returns the dealer is granted a credit
+		/// to send one more chunk, so a slow callback slows its dealer down
+		/// instead of piling up the chunks.
+		/// @note It should be called before router::listen. Chunks of a
+		/// socket without a stream callback are dropped.
+		/// @param name Name of the registered socket
+		/// @param callback Gets the client address and each chunk
+		void
+		registerStream(const std::string& name, streamCallback callback)
+		noexcept;
+
+		/// @brief Receive a request of the specified socket into a reusable
+		/// buffer, for consumers which pump the socket themselves instead of
+		/// router::listen. The frames are the client address, the message
+		/// and the header frame, if any.
+		/// Connect and disconnect notifications are skipped and the peers
+		/// are not tracked.
+		/// @note It should not be called while the router is listening.
+		/// @param name Name of the registered socket
+		/// @param buffer The buffer which the request is received into
+		/// @param timeout How long to wait for a request
+		/// @return true if a request is received in time and false otherwise.
+		bool
+		receive(
+				const std::string& name,
+				frameBuffer& buffer,
+				std::chrono::milliseconds timeout) noexcept;
+
+		/// @brief Compress the replies of the specified socket which are
+		/// long enough and do shrink.
+		/// The requests are decompressed whether or not the socket compresses.
+		/// @note It should be called before router::listen.
+		/// @param name Name of the registered socket
+		/// @param options Algorithm, threshold and dictionary
+		/// @return true if the socket is registered and false otherwise.
+		bool
+		compress(const std::string& name, compressionOptions options = {})
+		noexcept;
+
+		/// @brief Specify what the compressor of a socket did so far.
+		/// @param name Name of the registered socket
+		/// @return The statistics or nothing if the socket does not compress.
+		[[nodiscard]]
+		std::optional<compressor::statistics>
+		compression(const std::string& name) const noexcept;
+
+		/// @brief Specify the file descriptors which an external event loop
+		/// (e.g. epoll) should poll for reading instead of router::listen,
+		/// i.e. ZMQ_FD of each socket and the wakeup of the replies sent by
+		/// other threads. Once any of them is readable call router::pollOnce
+		/// with no timeout.
+		/// The sockets are bound and owned by the calling thread, which
+		/// should be the one calling router::pollOnce.
+		/// @note ZMQ_FD is edge triggered and it is not readable for every
+		/// request, router::pollOnce handles all the requests received so far.
+		/// @return The descriptors or nothing if the router is listening on
+		/// its own threads.
+		[[nodiscard]]
+		std::vector<int>
+		descriptors() noexcept;
+
+		/// @brief Specify ZMQ_EVENTS of the specified socket, i.e. whether
+		/// ZMQ_POLLIN and ZMQ_POLLOUT hold.
+		/// @param name Name of the registered socket
+		/// @return The events or zero if the socket is not registered.
+		[[nodiscard]]
+		int
+		events(const std::string& name) const noexcept;
+
+		/// @brief Poll all the sockets once on the calling thread, as a
+		/// reactor embedded into an application loop, and dispatch all the
+		/// received requests the way router::listen does.
+		/// Replies sent by other threads (e.g. worker lanes) are flushed and
+		/// the dead peers are evicted as well.
+		/// @note It should not be mixed with router::listen, it does nothing
+		/// while the router is listening on its own threads.
+		/// @param timeout How long to wait for a request, zero returns
+		/// at once and a negative timeout waits until anything happens.
+		/// @return Number of the dispatched requests.
+		std::size_t
+		pollOnce(std::chrono::milliseconds timeout) noexcept;
+
+		/// @brief Call router::pollOnce for the specified duration or until
+		/// router::stop is called.
+		/// @return Number of the dispatched requests.
+		std::size_t
+		runFor(std::chrono::milliseconds duration) noexcept;
+
+		/// @brief Make the listening threads (and router::pollOnce) spin on
+		/// their sockets for the spin period after each request instead of
+		/// sleeping in zmq::poll, so the requests of a busy socket are
+		/// picked up with the least latency. A socket which stays idle for
+		/// the spin period is polled by blocking again.
+		/// @note It should be called before router::listen. Each listening
+		/// thread (one per protocol which has sockets) spins on a core of
+		/// its own, so pin them to as many isolated CPUs.
+		/// @param options Spin period and CPUs of the listening threads
+		void
+		busyPoll(busyPollOptions options) noexcept;
+
+		/// @brief Place the router on a NUMA node. The listening threads
+		/// and the worker lanes are pinned to the CPUs of the node, so the
+		/// requests, replies and buffers which they allocate stay on the node
+		/// as well. The busy poll CPUs, if any, take precedence for the
+		/// listening threads. Construct the router on the context of the node
+		/// (see agoNetwork::numaNode::context) for its IO threads to follow.
+		/// @note It should be called before router::listen.
+		/// @param node The node, e.g. agoNetwork::numaNode::of the NIC
+		void
+		placeOn(const numaNode& node) noexcept;
+
+		/// @brief Make router::listen and router::runFor return.
+		/// router::listen joins the worker lanes, sends the replies queued
+		/// for the listening threads and gives the sockets up, so the router
+		/// could listen again. A stop which comes before router::listen or
+		/// router::runFor makes it return at once.
+		/// @note It could be called from any thread, from the callbacks too.
+		void
+		stop() noexcept;
 	};
 } // namespace agoNetwork
 
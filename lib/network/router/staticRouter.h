@@ -0,0 +1,189 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:07
+//
+
+#ifndef AGO_NETWORK_STATIC_ROUTER_H
+#define AGO_NETWORK_STATIC_ROUTER_H
+
+#include <array>
+#include <tuple>
+#include <lib/network/router/router.h>
+#include <lib/network/routing/fixedString.h>
+
+namespace agoNetwork::endpoint {
+	/// @brief A tcp socket of agoNetwork::staticRouter named at compile time.
+	template<fixedString name_>
+	class tcp {
+	public:
+		using socket_t = tcpSocket;
+		static constexpr auto name = name_;
+		/// The name which the router registers the socket by,
+		/// the same as the _tcp literal makes.
+		static constexpr auto key = name_+fixedString{ "_.:tcp:._" };
+
+		std::string address;
+		socketModel::heartbeat heartbeat{};
+
+		[[nodiscard]]
+		socketModel::tcp
+		model() const noexcept {
+			return { std::string{ name.view() }, address, heartbeat };
+		}
+	};
+
+	/// @brief An ipc socket of agoNetwork::staticRouter named at compile time.
+	template<fixedString name_>
+	class ipc {
+	public:
+		using socket_t = ipcSocket;
+		static constexpr auto name = name_;
+		static constexpr auto key = name_+fixedString{ "_.:ipc:._" };
+
+		std::string address;
+		socketModel::heartbeat heartbeat{};
+
+		[[nodiscard]]
+		socketModel::ipc
+		model() const noexcept {
+			return { std::string{ name.view() }, address, heartbeat };
+		}
+	};
+
+	/// @brief An inproc socket of agoNetwork::staticRouter named at compile
+	/// time.
+	template<fixedString name_>
+	class inproc {
+	public:
+		using socket_t = inprocSocket;
+		static constexpr auto name = name_;
+		static constexpr auto key = name_+fixedString{ "_.:inproc:._" };
+
+		std::string address;
+
+		[[nodiscard]]
+		socketModel::inproc
+		model() const noexcept {
+			return { std::string{ name.view() }, address };
+		}
+	};
+}
+
+namespace agoNetwork {
+	/// @brief **staticRouter** is a router whose endpoints are declared by
+	/// their types, e.g. endpoint::tcp<"orders">, so the names of the
+	/// callbacks and routes are checked at compile time.
+	/// A misspelled name or a callback which does not take the socket of
+	/// its endpoint fails to compile, where router::registerCallback would
+	/// silently ignore it.
+	/// The rest of the router is reached by operator->, with the names
+	/// made by staticRouter::key.
+	/// @tparam endpoint_t The endpoints, their names should be distinct.
+	template<typename... endpoint_t>
+	class staticRouter final {
+	private: // private data
+		router _router;
+
+		/// The compile time hashes of the endpoint names.
+		static constexpr std::array<std::uint64_t, sizeof...(endpoint_t)> hashes_{
+				endpoint_t::name.hash()... };
+		/// The endpoint names.
+		static constexpr std::array<std::string_view, sizeof...(endpoint_t)> names_{
+				endpoint_t::name.view()... };
+
+		/// @brief Specify the index of the endpoint of a name.
+		/// @return The index or the number of the endpoints if no endpoint
+		/// has the name.
+		template<fixedString name>
+		static constexpr std::size_t
+		index_() noexcept {
+			for (std::size_t index{ 0 }; index<sizeof...(endpoint_t); ++index) {
+				if (hashes_[index]==name.hash() && names_[index]==name.view()) {
+					return index;
+				}
+			}
+			return sizeof...(endpoint_t);
+		}
+
+		/// @brief Specify whether the endpoint names are distinct.
+		static constexpr bool
+		distinct_() noexcept {
+			for (std::size_t index{ 0 }; index<sizeof...(endpoint_t); ++index) {
+				for (std::size_t other{ index+1 }; other<sizeof...(endpoint_t); ++other) {
+					if (names_[index]==names_[other]) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		static_assert(distinct_(),
+				"agoNetwork::staticRouter endpoints should have distinct names");
+
+		/// The endpoint of a name.
+		template<fixedString name>
+		using endpoint_ = std::tuple_element_t<
+				index_<name>(),
+				std::tuple<endpoint_t...>>;
+
+	public: // constructors and destructors
+		explicit
+		staticRouter(endpoint_t... endpoints) noexcept
+				:_router{ endpoints.model()... } {}
+
+	public: // public methods
+		/// @brief Specify the name which the router registers an endpoint by.
+		template<fixedString name>
+		static const std::string&
+		key() noexcept {
+			static_assert(index_<name>()<sizeof...(endpoint_t),
+					"agoNetwork::staticRouter has no endpoint of this name");
+			static const std::string key{ endpoint_<name>::key.view() };
+			return key;
+		}
+
+		/// @brief Registers callbacks of an endpoint.
+		/// @see router::registerCallback
+		template<fixedString name, routerCallback... routerCallback_>
+		void
+		registerCallback(const routerCallback_& ... callback_) noexcept {
+			static_assert(index_<name>()<sizeof...(endpoint_t),
+					"agoNetwork::staticRouter has no endpoint of this name");
+			static_assert((std::is_invocable_v<routerCallback_,
+							const std::shared_ptr<typename endpoint_<name>::socket_t>&,
+							const std::vector<std::string>&> && ...),
+					"the callback does not take the socket of its endpoint");
+			_router.registerCallback(key<name>(), callback_...);
+		}
+
+		/// @brief Registers callbacks of a route of an endpoint.
+		/// @see router::registerRoute
+		template<fixedString name, fixedString route, routerCallback... routerCallback_>
+		void
+		registerRoute(const routerCallback_& ... callback_) noexcept {
+			static_assert(index_<name>()<sizeof...(endpoint_t),
+					"agoNetwork::staticRouter has no endpoint of this name");
+			static_assert((std::is_invocable_v<routerCallback_,
+							const std::shared_ptr<typename endpoint_<name>::socket_t>&,
+							const std::vector<std::string>&> && ...),
+					"the callback does not take the socket of its endpoint");
+			_router.registerRoute(key<name>(), std::string{ route.view() }, callback_...);
+		}
+
+		/// @brief Make all the sockets start listening.
+		void
+		listen() noexcept {
+			_router.listen();
+		}
+
+		/// @brief Access the router itself.
+		router*
+		operator->() noexcept {
+			return &_router;
+		}
+	};
+}
+
+#endif //AGO_NETWORK_STATIC_ROUTER_H
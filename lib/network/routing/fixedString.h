@@ -0,0 +1,80 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:07
+//
+
+#ifndef AGO_NETWORK_FIXED_STRING_H
+#define AGO_NETWORK_FIXED_STRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace agoNetwork {
+	/// @brief **fixedString** is a string literal which could be a non-type
+	/// template parameter, so names and routes are known at compile time.
+	/// @tparam N Size of the literal including its terminating zero.
+	template<std::size_t N>
+	struct fixedString {
+		char value[N]{};
+
+		constexpr
+		fixedString() noexcept = default;
+
+		constexpr
+		fixedString(const char (& literal)[N]) noexcept {
+			for (std::size_t index{ 0 }; index<N; ++index) {
+				value[index] = literal[index];
+			}
+		}
+
+		/// @brief Specify the length of the string.
+		[[nodiscard]]
+		constexpr std::size_t
+		size() const noexcept {
+			return N-1;
+		}
+
+		/// @brief View the string without its terminating zero.
+		[[nodiscard]]
+		constexpr std::string_view
+		view() const noexcept {
+			return { value, N-1 };
+		}
+
+		/// @brief Hash the string by 64 bit FNV-1a at compile time.
+		[[nodiscard]]
+		constexpr std::uint64_t
+		hash() const noexcept {
+			std::uint64_t hash{ 14695981039346656037ull };
+			for (std::size_t index{ 0 }; index<N-1; ++index) {
+				hash ^= static_cast<unsigned char>(value[index]);
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		template<std::size_t M>
+		constexpr bool
+		operator==(const fixedString<M>& other) const noexcept {
+			return view()==other.view();
+		}
+	};
+
+	/// @brief Concatenate two fixed strings at compile time.
+	template<std::size_t N, std::size_t M>
+	constexpr fixedString<N+M-1>
+	operator+(const fixedString<N>& left, const fixedString<M>& right) noexcept {
+		fixedString<N+M-1> string;
+		for (std::size_t index{ 0 }; index<N-1; ++index) {
+			string.value[index] = left.value[index];
+		}
+		for (std::size_t index{ 0 }; index<M; ++index) {
+			string.value[N-1+index] = right.value[index];
+		}
+		return string;
+	}
+}
+
+#endif //AGO_NETWORK_FIXED_STRING_H
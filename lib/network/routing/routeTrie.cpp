@@ -0,0 +1,106 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:03
+//
+
+#include <lib/network/routing/routeTrie.h>
+
+namespace agoNetwork {
+	std::size_t routeTrie::
+	insert(const std::string& route) noexcept {
+		_nodes.clear();
+		return _routes.try_emplace(route, _routes.size()).first->second;
+	}
+
+	void routeTrie::
+	build() noexcept {
+		_nodes.assign(1, node{});
+		_branches.assign(1, '\0');
+		_labels.clear();
+		build_(0, _routes.cbegin(), _routes.cend(), 0);
+	}
+
+	void routeTrie::
+	build_(
+			std::uint32_t parent,
+			std::map<std::string, std::size_t>::const_iterator begin,
+			std::map<std::string, std::size_t>::const_iterator end,
+			std::size_t depth) noexcept {
+		// the routes are sorted, so the one ending here comes first
+		if (begin!=end && begin->first.size()==depth) {
+			_nodes[parent].route = begin->second;
+			++begin;
+		}
+		// each group of the routes sharing the next byte is a child
+		std::vector<std::pair<
+				std::map<std::string, std::size_t>::const_iterator,
+				std::map<std::string, std::size_t>::const_iterator>> groups;
+		for (auto first = begin; first!=end;) {
+			auto last = first;
+			while (last!=end && last->first[depth]==first->first[depth]) {
+				++last;
+			}
+			groups.emplace_back(first, last);
+			first = last;
+		}
+		const auto firstChild = static_cast<std::uint32_t>(_nodes.size());
+		_nodes[parent].firstChild = firstChild;
+		_nodes[parent].children = static_cast<std::uint32_t>(groups.size());
+		_nodes.resize(_nodes.size()+groups.size());
+		_branches.resize(_nodes.size());
+		for (std::size_t child{ 0 }; child<groups.size(); ++child) {
+			const auto&[first, last] = groups[child];
+			// the label runs as far as the first and the last route agree
+			const auto& front = first->first;
+			const auto& back = std::prev(last)->first;
+			auto labelEnd = depth+1;
+			while (labelEnd<front.size() && labelEnd<back.size()
+					&& front[labelEnd]==back[labelEnd]) {
+				++labelEnd;
+			}
+			auto& _node = _nodes[firstChild+child];
+			_node.labelOffset = static_cast<std::uint32_t>(_labels.size());
+			_node.labelSize = static_cast<std::uint32_t>(labelEnd-depth);
+			_labels.append(front, depth, labelEnd-depth);
+			_branches[firstChild+child] = front[depth];
+			build_(static_cast<std::uint32_t>(firstChild+child), first, last, labelEnd);
+		}
+	}
+
+	std::optional<std::size_t> routeTrie::
+	match(std::string_view message) const noexcept {
+		if (_nodes.empty()) {
+			return std::nullopt;
+		}
+		auto route = _nodes.front().route;
+		std::size_t position{ 0 };
+		std::uint32_t current{ 0 };
+		while (position<message.size()) {
+			const auto& parent = _nodes[current];
+			const std::string_view branches{
+					_branches.data()+parent.firstChild,
+					parent.children };
+			const auto branch = branches.find(message[position]);
+			if (branch==std::string_view::npos) {
+				break;
+			}
+			current = parent.firstChild+static_cast<std::uint32_t>(branch);
+			const auto& child = _nodes[current];
+			if (message.substr(position, child.labelSize)
+					!=std::string_view{ _labels.data()+child.labelOffset, child.labelSize }) {
+				break;
+			}
+			position += child.labelSize;
+			if (child.route) {
+				route = child.route;
+			}
+		}
+		return route;
+	}
+
+	std::size_t routeTrie::
+	size() const noexcept {
+		return _routes.size();
+	}
+}
@@ -0,0 +1,95 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:03
+//
+
+#ifndef AGO_NETWORK_ROUTE_TRIE_H
+#define AGO_NETWORK_ROUTE_TRIE_H
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace agoNetwork {
+	/// @brief **routeTrie** maps the routes of a socket, i.e. topic prefixes
+	/// or leading type ids of the messages, to their indexes.
+	/// Routes are inserted before the router listens, then routeTrie::build
+	/// packs them into a compact radix trie: the nodes and the children of
+	/// each node are contiguous and all the edge labels share one string,
+	/// so a message is matched in O(route length) without any allocation.
+	/// @note A built trie is read only and could be matched by any thread.
+	class routeTrie final {
+	private: // private data
+		/// @brief A node of the built trie.
+		struct node {
+			/// The edge label which leads to the node.
+			std::uint32_t labelOffset{ 0 };
+			std::uint32_t labelSize{ 0 };
+			/// The children are contiguous nodes.
+			std::uint32_t firstChild{ 0 };
+			std::uint32_t children{ 0 };
+			/// Index of the route which ends at the node, if any.
+			std::optional<std::size_t> route;
+		};
+		/// Maps each inserted route to its index.
+		std::map<std::string, std::size_t> _routes;
+		std::vector<node> _nodes;
+		/// The first label byte of each node, so the children of a node
+		/// are scanned as contiguous bytes.
+		std::string _branches;
+		/// All the edge labels.
+		std::string _labels;
+
+	private: // private methods
+		/// @brief Build the children of a node out of the sorted routes
+		/// which share its prefix.
+		void
+		build_(
+				std::uint32_t,
+				std::map<std::string, std::size_t>::const_iterator,
+				std::map<std::string, std::size_t>::const_iterator,
+				std::size_t) noexcept;
+
+	public: // public methods
+		/// @brief Insert a route, an inserted route keeps its index.
+		/// @note It invalidates the built trie until routeTrie::build.
+		/// @return Index of the route.
+		std::size_t
+		insert(const std::string&) noexcept;
+
+		/// @brief Pack the inserted routes into the radix trie.
+		void
+		build() noexcept;
+
+		/// @brief Find the longest route which prefixes the message.
+		/// @return Index of the route or nothing if no route matches.
+		[[nodiscard]]
+		std::optional<std::size_t>
+		match(std::string_view) const noexcept;
+
+		/// @brief Specify the number of the routes.
+		[[nodiscard]]
+		std::size_t
+		size() const noexcept;
+	};
+
+	/// @brief Make the route of a message type by its leading type id,
+	/// which is the same bytes as agoNetwork::fixedCodec writes for it.
+	/// @return The route.
+	template<typename integer_t>
+	requires std::is_integral_v<integer_t>
+	std::string
+	typeRoute(integer_t type) noexcept {
+		std::string route(sizeof(integer_t), '\0');
+		std::memcpy(route.data(), &type, sizeof(integer_t));
+		return route;
+	}
+}
+
+#endif //AGO_NETWORK_ROUTE_TRIE_H
@@ -5,10 +5,41 @@
 // Last edit on 3/31/20 15:20
 //
 
+#include <cstring>
+#include <utility>
 #include <lib/network/socket/socket.h>
 #include <lib/network/zmq/zhelpers.hpp>
+#include <lib/network/envelope/envelope.h>
+#include <lib/network/log/logger.h>
 
 namespace agoNetwork {
+    namespace {
+        /// The observer of each thread.
+        thread_local socket::observer currentObserver;
+        /// The correlation of each thread.
+        thread_local const socket::correlation *currentCorrelation{nullptr};
+    }
+
+    socket::observation::
+    observation(observer _observer) noexcept:
+            _previous{std::exchange(currentObserver, std::move(_observer))} {}
+
+    socket::observation::
+    ~observation() {
+        currentObserver = std::move(_previous);
+    }
+
+    socket::correlation::
+    correlation(std::string address, std::string header) noexcept:
+            _address{std::move(address)},
+            _header{std::move(header)},
+            _previous{std::exchange(currentCorrelation, this)} {}
+
+    socket::correlation::
+    ~correlation() {
+        currentCorrelation = _previous;
+    }
+
     socket::
     socket(
             std::string socketName,
@@ -31,22 +62,196 @@ namespace agoNetwork {
 
     void socket::
     send(const std::string &address, const std::string &string) noexcept {
+        send(address, string, {});
+    }
+
+    void socket::
+    send(const std::string &address,
+         const std::string &string,
+         const std::string &header) noexcept {
+        if (header.empty() && currentCorrelation
+            && not currentCorrelation->_header.empty()
+            && currentCorrelation->_address == address) {
+            send(address, string, currentCorrelation->_header);
+            return;
+        }
+        if (currentObserver) {
+            currentObserver(address, string);
+        }
+        if (_outbox->owner != std::thread::id{}
+            && _outbox->owner != std::this_thread::get_id()) {
+            {
+                std::lock_guard lock{_outbox->mutex};
+                _outbox->messages.emplace_back(address, string, header);
+            }
+            _outbox->wakeup();
+            return;
+        }
+        // compress right before writing, so queued messages are
+        // compressed once by the owner thread
+        const auto *frameHeader = &header;
+        const auto *message = &string;
+        std::string compressedHeader;
+        std::string compressedMessage;
+        if (_compressor && (_socketType == socketType::router
+                            || _socketType == socketType::dealer)) {
+            if (auto compressed = _compressor->compress(string)) {
+                auto decoded = envelope::decode(header).value_or(envelope::header{});
+                decoded.compressed = compressed->first;
+                compressedHeader = envelope::encode(decoded);
+                compressedMessage = std::move(compressed->second);
+                frameHeader = &compressedHeader;
+                message = &compressedMessage;
+            }
+        }
         switch (_socketType) {
             case socketType::router: {
-                s_sendmore(*_socket, address);
+                for (const auto &hop : envelope::hops(address)) {
+                    s_sendmore(*_socket, hop);
+                }
                 s_sendmore(*_socket, "");
-                s_send(*_socket, string);
+                if (not frameHeader->empty()) {
+                    s_sendmore(*_socket, *frameHeader);
+                }
+                s_send(*_socket, *message);
                 break;
             }
             case socketType::dealer: {
                 s_sendmore(*_socket, "");
-                s_send(*_socket, string);
+                if (not frameHeader->empty()) {
+                    s_sendmore(*_socket, *frameHeader);
+                }
+                s_send(*_socket, *message);
                 break;
             }
             case socketType::request ... socketType::reply: {
                 s_send(*_socket, string);
                 break;
             }
+            case socketType::push: {
+                s_send(*_socket, string);
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    std::size_t socket::
+    sendBatch(const std::string &address,
+              const std::vector<std::string_view> &messages,
+              const std::string &header) noexcept {
+        if (_compressor && (_socketType == socketType::router
+                            || _socketType == socketType::dealer)) {
+            // each message is compressed on its own
+            for (const auto &message : messages) {
+                send(address, std::string{message}, header);
+            }
+            return messages.size();
+        }
+        if (currentObserver) {
+            for (const auto &message : messages) {
+                currentObserver(address, std::string{message});
+            }
+        }
+        if (_outbox->owner != std::thread::id{}
+            && _outbox->owner != std::this_thread::get_id()) {
+            {
+                std::lock_guard lock{_outbox->mutex};
+                for (const auto &message : messages) {
+                    _outbox->messages.emplace_back(address, std::string{message}, header);
+                }
+            }
+            _outbox->wakeup();
+            return messages.size();
+        }
+        const auto hops = _socketType == socketType::router
+                          ? envelope::hops(address)
+                          : std::vector<std::string>{};
+        std::size_t sent{0};
+        try {
+            for (const auto &message : messages) {
+                switch (_socketType) {
+                    case socketType::router: {
+                        for (const auto &hop : hops) {
+                            _socket->send(hop.data(), hop.size(), ZMQ_SNDMORE);
+                        }
+                        [[fallthrough]];
+                    }
+                    case socketType::dealer: {
+                        _socket->send("", 0, ZMQ_SNDMORE);
+                        if (not header.empty()) {
+                            _socket->send(header.data(), header.size(), ZMQ_SNDMORE);
+                        }
+                        _socket->send(message.data(), message.size(), 0);
+                        break;
+                    }
+                    case socketType::request ... socketType::reply:
+                    case socketType::push: {
+                        _socket->send(message.data(), message.size(), 0);
+                        break;
+                    }
+                    default: {
+                        return sent;
+                    }
+                }
+                ++sent;
+            }
+        } catch (zmq::error_t &error) {
+            logger::error("Error in sending a batch on socket {}, what? {}",
+                    _socketName, error.what());
+        }
+        return sent;
+    }
+
+    void socket::
+    sendShared(const std::string &address,
+               std::shared_ptr<const void> owner,
+               std::string_view data,
+               const std::string &header) noexcept {
+        if ((_outbox->owner != std::thread::id{}
+             && _outbox->owner != std::this_thread::get_id())
+            || currentObserver || _compressor) {
+            send(address, std::string{data}, header);
+            return;
+        }
+        try {
+            switch (_socketType) {
+                case socketType::router: {
+                    for (const auto &hop : envelope::hops(address)) {
+                        _socket->send(hop.data(), hop.size(), ZMQ_SNDMORE);
+                    }
+                    [[fallthrough]];
+                }
+                case socketType::dealer: {
+                    _socket->send("", 0, ZMQ_SNDMORE);
+                    if (not header.empty()) {
+                        _socket->send(header.data(), header.size(), ZMQ_SNDMORE);
+                    }
+                    break;
+                }
+                case socketType::request ... socketType::reply:
+                case socketType::push: {
+                    break;
+                }
+                default: {
+                    return;
+                }
+            }
+            // zmq releases the owner once the bytes are sent
+            auto hint = std::make_unique<std::shared_ptr<const void>>(std::move(owner));
+            zmq::message_t message{
+                    const_cast<char *>(data.data()),
+                    data.size(),
+                    [](void *, void *hint) {
+                        delete static_cast<std::shared_ptr<const void> *>(hint);
+                    },
+                    hint.get()};
+            hint.release();
+            _socket->send(message);
+        } catch (zmq::error_t &error) {
+            logger::error("Error in sending on socket {}, what? {}", _socketName, error.what());
         }
     }
 
@@ -54,15 +259,50 @@ namespace agoNetwork {
     receive() noexcept {
         switch (_socketType) {
             case socketType::router: {
-                const auto remoteAddress = s_recv(*_socket);
-                s_recv(*_socket);
-                const auto message = s_recv(*_socket);
-                return {remoteAddress, message};
+                // brokers prepend their own identity to the envelope,
+                // so read the routing frames until the empty delimiter.
+                std::vector<std::string> hops{s_recv(*_socket)};
+                auto frame = s_recv(*_socket);
+                while (not frame.empty() && more_()) {
+                    hops.push_back(frame);
+                    frame = s_recv(*_socket);
+                }
+                if (frame.empty() && not more_() && hops.size()==1) {
+                    // the peer connected or disconnected
+                    return {hops.front()};
+                }
+                auto message = more_() ? s_recv(*_socket) : frame;
+                // a header frame could precede the message
+                std::string header;
+                if (more_()) {
+                    header = std::move(message);
+                    message = s_recv(*_socket);
+                }
+                drain_();
+                if (not inflate_(message, header)) {
+                    return {};
+                }
+                if (header.empty()) {
+                    return {envelope::route(hops), message};
+                }
+                return {envelope::route(hops), message, header};
             }
             case socketType::dealer: {
                 const auto emptyFrame = s_recv(*_socket);
-                const auto message = s_recv(*_socket);
-                return {message};
+                auto message = s_recv(*_socket);
+                std::string header;
+                if (more_()) {
+                    header = std::move(message);
+                    message = s_recv(*_socket);
+                }
+                drain_();
+                if (not inflate_(message, header)) {
+                    return {};
+                }
+                if (header.empty()) {
+                    return {message};
+                }
+                return {message, header};
             }
             case socketType::request: {
                 const auto message = s_recv(*_socket);
@@ -72,12 +312,268 @@ namespace agoNetwork {
                 const auto message = s_recv(*_socket);
                 return {message};
             }
+            case socketType::pull: {
+                const auto message = s_recv(*_socket);
+                return {message};
+            }
             default: {
                 return {};
             }
         }
     }
 
+    bool socket::
+    receive(frameBuffer &buffer) noexcept {
+        buffer.clear();
+        try {
+            switch (_socketType) {
+                case socketType::router: {
+                    // the routing frames until the empty delimiter
+                    if (not receiveFrame_(buffer) || not receiveFrame_(buffer)) {
+                        break;
+                    }
+                    std::size_t hops{1};
+                    bool received{true};
+                    while (received && not buffer.view(hops).empty() && more_()) {
+                        ++hops;
+                        received = receiveFrame_(buffer);
+                    }
+                    if (not received) {
+                        break;
+                    }
+                    if (buffer.view(hops).empty() && not more_() && hops == 1) {
+                        // the peer connected or disconnected
+                        buffer.pop_();
+                        return true;
+                    }
+                    if (more_()) {
+                        // the delimiter precedes the message
+                        buffer.pop_();
+                        if (not receiveFrame_(buffer)) {
+                            break;
+                        }
+                    }
+                    if (more_()) {
+                        // a header frame precedes the message
+                        if (not receiveFrame_(buffer)) {
+                            break;
+                        }
+                        buffer.swap_(hops, hops + 1);
+                    }
+                    drain_();
+                    if (hops > 1) {
+                        // brokers in between, pack their frames into one address
+                        std::vector<std::string> frames;
+                        for (std::size_t frame{0}; frame < buffer.size(); ++frame) {
+                            frames.emplace_back(buffer.view(frame));
+                        }
+                        const auto address = envelope::route(std::vector<std::string>(
+                                frames.begin(), frames.begin() + static_cast<long>(hops)));
+                        buffer.clear();
+                        buffer.append_(address);
+                        for (auto frame = frames.begin() + static_cast<long>(hops);
+                             frame != frames.end(); ++frame) {
+                            buffer.append_(*frame);
+                        }
+                        if (buffer.truncated()) {
+                            return false;
+                        }
+                    }
+                    return inflate_(buffer, 1);
+                }
+                case socketType::dealer: {
+                    // the empty delimiter
+                    if (not receiveFrame_(buffer)) {
+                        break;
+                    }
+                    buffer.pop_();
+                    if (not receiveFrame_(buffer)) {
+                        break;
+                    }
+                    if (more_()) {
+                        // a header frame precedes the message
+                        if (not receiveFrame_(buffer)) {
+                            break;
+                        }
+                        buffer.swap_(0, 1);
+                    }
+                    drain_();
+                    return inflate_(buffer, 0);
+                }
+                case socketType::request ... socketType::reply:
+                case socketType::pull: {
+                    if (not receiveFrame_(buffer)) {
+                        break;
+                    }
+                    return true;
+                }
+                default: {
+                    return false;
+                }
+            }
+            // the rest of a dropped message
+            drain_();
+        } catch (zmq::error_t &error) {
+            logger::error("Error in receiving on socket {}, what? {}", _socketName, error.what());
+        }
+        buffer.drop_();
+        return false;
+    }
+
+    bool socket::
+    receiveFrame_(frameBuffer &buffer) {
+        zmq::message_t frame;
+        if (not _socket->recv(&frame)) {
+            return false;
+        }
+        const auto memory = buffer.append_(frame.size());
+        if (buffer.truncated()) {
+            return false;
+        }
+        if (frame.size() > 0) {
+            std::memcpy(memory.data(), frame.data(), frame.size());
+        }
+        return true;
+    }
+
+    bool socket::
+    inflate_(frameBuffer &buffer, std::size_t message) noexcept {
+        if (buffer.size() <= message + 1) {
+            return true;
+        }
+        std::string header{buffer.view(message + 1)};
+        const auto decoded = envelope::decode(header);
+        if (not decoded || not decoded->compressed) {
+            return true;
+        }
+        std::string plain{buffer.view(message)};
+        if (not inflate_(plain, header)) {
+            buffer.clear();
+            return false;
+        }
+        // the message and its header are the last frames
+        buffer.pop_();
+        buffer.pop_();
+        return buffer.append_(plain) && buffer.append_(header);
+    }
+
+    bool socket::
+    more_() const noexcept {
+        int more{0};
+        size_t moreSize{sizeof(more)};
+        _socket->getsockopt(ZMQ_RCVMORE, &more, &moreSize);
+        return more != 0;
+    }
+
+    void socket::
+    drain_() noexcept {
+        while (more_()) {
+            s_recv(*_socket);
+        }
+    }
+
+    bool socket::
+    inflate_(std::string &message, const std::string &header) noexcept {
+        if (header.empty()) {
+            return true;
+        }
+        const auto decoded = envelope::decode(header);
+        if (not decoded || not decoded->compressed) {
+            return true;
+        }
+        // a socket which does not compress still decompresses what it gets
+        static compressor plain{};
+        auto &decompressor = _compressor ? *_compressor : plain;
+        auto decompressed = decompressor.decompress(*decoded->compressed, message);
+        if (not decompressed) {
+            logger::error("Error in decompressing a message on socket {}, the message is dropped",
+                    _socketName);
+            return false;
+        }
+        message = std::move(*decompressed);
+        return true;
+    }
+
+    bool socket::
+    bindable_() const noexcept {
+        return _socketType == socketType::router
+               || _socketType == socketType::push
+               || _socketType == socketType::pull;
+    }
+
+    bool socket::
+    connectable_() const noexcept {
+        return _socketType == socketType::dealer
+               || _socketType == socketType::push
+               || _socketType == socketType::pull;
+    }
+
+    void socket::
+    own(std::function<void()> wakeup) noexcept {
+        _outbox->wakeup = std::move(wakeup);
+        _outbox->owner = std::this_thread::get_id();
+    }
+
+    void socket::
+    flush() noexcept {
+        std::vector<std::tuple<std::string, std::string, std::string>> messages;
+        {
+            std::lock_guard lock{_outbox->mutex};
+            messages.swap(_outbox->messages);
+        }
+        for (const auto &[address, message, header] : messages) {
+            send(address, message, header);
+        }
+    }
+
+    void socket::
+    disown() noexcept {
+        _outbox->owner = std::thread::id{};
+        // messages queued before the owner is reset are sent here
+        flush();
+    }
+
+    std::size_t socket::
+    purge(const std::string &address) noexcept {
+        std::lock_guard lock{_outbox->mutex};
+        return std::erase_if(_outbox->messages, [&address](const auto &message) {
+            return std::get<0>(message) == address;
+        });
+    }
+
+    void socket::
+    heartbeat(const socketModel::heartbeat &options) noexcept {
+        if (options.interval.count() <= 0) {
+            return;
+        }
+        try {
+            _socket->setsockopt(ZMQ_HEARTBEAT_IVL, static_cast<int>(options.interval.count()));
+            if (options.ttl.count() > 0) {
+                _socket->setsockopt(ZMQ_HEARTBEAT_TTL, static_cast<int>(options.ttl.count()));
+            }
+            if (options.timeout.count() > 0) {
+                _socket->setsockopt(ZMQ_HEARTBEAT_TIMEOUT, static_cast<int>(options.timeout.count()));
+            }
+            if (_socketType == socketType::dealer) {
+                // do not queue requests to a peer which is not there
+                _socket->setsockopt(ZMQ_IMMEDIATE, 1);
+            }
+        } catch (zmq::error_t &error) {
+            logger::error("Error in configuring heartbeats of socket {}, what? {}",
+                    _socketName, error.what());
+        }
+    }
+
+    void socket::
+    compress(std::shared_ptr<compressor> _compressor) noexcept {
+        this->_compressor = std::move(_compressor);
+    }
+
+    std::shared_ptr<compressor> socket::
+    compression() const noexcept {
+        return _compressor;
+    }
+
     std::string socket::
     name() noexcept {
         return _socketName;
@@ -104,31 +600,27 @@ namespace agoNetwork {
 
     void tcpSocket::
     bind() const noexcept {
-        if (_socketType == socketType::router) {
+        if (bindable_()) {
             try {
                 _socket->bind("tcp://" + _socketAddress);
             } catch (zmq::error_t &error) {
-                std::cout << "Error in binding to tcp socket " << _socketName << " on address " << _socketAddress
-                          << ", what? " << error.what() << std::endl;
+                logger::error("Error in binding to tcp socket {} on address {}, what? {}",
+                        _socketName, _socketAddress, error.what());
             }
         }
     }
 
     void tcpSocket::
     connect() const noexcept {
-        if (_socketType == socketType::dealer) {
+        if (connectable_()) {
             try {
-                s_set_id(*_socket);
+                if (_socketType == socketType::dealer) {
+                    s_set_id(*_socket);
+                }
                 _socket->connect("tcp://" + _socketAddress);
             } catch (zmq::error_t &error) {
-                std::cout
-                        << "Error in connecting to tcp socket "
-                        << _socketName
-                        << " on address "
-                        << _socketAddress
-                        << ", what?"
-                        << error.what()
-                        << std::endl;
+                logger::error("Error in connecting to tcp socket {} on address {}, what? {}",
+                        _socketName, _socketAddress, error.what());
             }
         }
     }
@@ -174,38 +666,28 @@ namespace agoNetwork {
 
     void ipcSocket::
     bind() const noexcept {
-        if (_socketType == socketType::router) {
+        if (bindable_()) {
             try {
                 _socket->bind("ipc://" + _socketAddress + ".ipc");
             } catch (zmq::error_t &error) {
-                std::cout
-                        << "Error in binding to ipc socket "
-                        << _socketName
-                        << " on address "
-                        << _socketAddress
-                        << ", what? "
-                        << error.what()
-                        << std::endl;
+                logger::error("Error in binding to ipc socket {} on address {}, what? {}",
+                        _socketName, _socketAddress, error.what());
             }
         }
     }
 
     void ipcSocket::
     connect() const noexcept {
-        if (_socketType == socketType::dealer) {
+        if (connectable_()) {
             try {
-                s_set_id(*_socket);
-                _socket->connect("ipc://" + _socketAddress);
+                if (_socketType == socketType::dealer) {
+                    s_set_id(*_socket);
+                }
+                _socket->connect("ipc://" + _socketAddress + ".ipc");
             }
             catch (zmq::error_t &error) {
-                std::cout
-                        << "Error in connecting to tcp socket "
-                        << _socketName
-                        << " on address "
-                        << _socketAddress
-                        << ", what?"
-                        << error.what()
-                        << std::endl;
+                logger::error("Error in connecting to tcp socket {} on address {}, what? {}",
+                        _socketName, _socketAddress, error.what());
             }
         }
     }
@@ -251,37 +733,27 @@ namespace agoNetwork {
 
     void inprocSocket::
     bind() const noexcept {
-        if (_socketType == socketType::router) {
+        if (bindable_()) {
             try {
                 _socket->bind("inproc://" + _socketAddress + ".inproc");
             } catch (zmq::error_t &error) {
-                std::cout
-                        << "Error in binding to inproc socket "
-                        << _socketName
-                        << " on address "
-                        << _socketAddress
-                        << ", what? "
-                        << error.what()
-                        << std::endl;
+                logger::error("Error in binding to inproc socket {} on address {}, what? {}",
+                        _socketName, _socketAddress, error.what());
             }
         }
     }
 
     void inprocSocket::
     connect() const noexcept {
-        if (_socketType == socketType::dealer) {
+        if (connectable_()) {
             try {
-                s_set_id(*_socket);
-                _socket->connect("inproc://" + _socketAddress);
+                if (_socketType == socketType::dealer) {
+                    s_set_id(*_socket);
+                }
+                _socket->connect("inproc://" + _socketAddress + ".inproc");
             } catch (zmq::error_t &error) {
-                std::cout
-                        << "Error in connecting to tcp socket "
-                        << _socketName
-                        << " on address "
-                        << _socketAddress
-                        << ", what?"
-                        << error.what()
-                        << std::endl;
+                logger::error("Error in connecting to tcp socket {} on address {}, what? {}",
+                        _socketName, _socketAddress, error.what());
             }
         }
     }
@@ -8,17 +8,46 @@
 #ifndef AGO_NETWORK_SOCKET_H
 #define AGO_NETWORK_SOCKET_H
 
+#include <atomic>
+#include <chrono>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <functional>
 #include <zmq.hpp>
+#include <lib/network/compression/compressor.h>
+#include <lib/network/buffer/frameBuffer.h>
 
 namespace agoNetwork {
+	namespace socketModel {
+		/// @brief Heartbeat options of a connection.
+		/// A zero interval means no heartbeat at all.
+		/// @see ZMQ_HEARTBEAT_IVL, ZMQ_HEARTBEAT_TTL and ZMQ_HEARTBEAT_TIMEOUT
+		class heartbeat {
+		public:
+			/// How often the heartbeats are sent.
+			std::chrono::milliseconds interval{ 0 };
+			/// How long the remote peer waits for the next heartbeat,
+			/// zero means no limit.
+			std::chrono::milliseconds ttl{ 0 };
+			/// How long a heartbeat reply is waited for before the connection
+			/// is closed, zero means the interval.
+			std::chrono::milliseconds timeout{ 0 };
+		};
+	}
+
 	/// @brief Represents zmq socket types.
 	enum class socketType {
 		request = ZMQ_REQ,
 		reply = ZMQ_REP,
 		dealer = ZMQ_DEALER,
 		router = ZMQ_ROUTER,
+		pull = ZMQ_PULL,
+		push = ZMQ_PUSH,
 	};
 	/// @brief Represents communication protocols.
 	enum class protocol {
@@ -38,6 +67,57 @@ namespace agoNetwork {
 	/// @see agoNetwork::socketType
 	/// @see agoNetwork::protocol
 	class socket {
+	public: // public data
+		/// @brief observer is a function alias which gets the address and the
+		/// message of each message sent by the observing thread.
+		using observer =
+		std::function<void(const std::string&, const std::string&)>;
+
+		/// @brief Observes the messages which are sent by the calling thread
+		/// (on any socket) while the object is in scope.
+		class observation final {
+		private:
+			/// The observer which was observing before this one.
+			observer _previous;
+
+		public:
+			explicit
+			observation(observer) noexcept;
+
+			observation(const observation&) = delete;
+
+			observation&
+			operator=(const observation&) = delete;
+
+			/// @brief Restore the previous observer.
+			~observation();
+		};
+
+		/// @brief Attaches a header to the messages which are sent by the
+		/// calling thread to the specified address without a header of their
+		/// own, while the object is in scope.
+		/// The router uses it to echo the request id on the replies.
+		class correlation final {
+			friend class socket;
+
+		private:
+			std::string _address;
+			std::string _header;
+			/// The correlation which was in scope before this one.
+			const correlation* _previous;
+
+		public:
+			correlation(std::string address, std::string header) noexcept;
+
+			correlation(const correlation&) = delete;
+
+			correlation&
+			operator=(const correlation&) = delete;
+
+			/// @brief Restore the previous correlation.
+			~correlation();
+		};
+
 	protected: // protected data
 		/// @brief Socket name.
 		/// It used to specify the socket by its name.
@@ -58,6 +138,26 @@ namespace agoNetwork {
 		/// which initialized with agoNetwork::socketType::router.
 		socketType _socketType{ socketType::router };
 
+		/// @brief Messages which are sent by other threads while the socket
+		/// is owned by a poll loop.
+		/// zmq sockets are not thread safe, so those messages are queued and
+		/// sent by the owner thread on socket::flush.
+		struct outbox {
+			/// The owner thread, no thread means the socket is not owned.
+			std::atomic<std::thread::id> owner;
+			/// Wakes the owner thread up in order to flush the messages.
+			std::function<void()> wakeup;
+			std::mutex mutex;
+			/// Address, message and header of the queued messages.
+			std::vector<std::tuple<std::string, std::string, std::string>>
+					messages;
+		};
+		/// @brief The outbox which is shared between the socket copies.
+		std::shared_ptr<outbox> _outbox{ std::make_shared<outbox>() };
+		/// @brief Compresses the messages of router and dealer sockets,
+		/// shared between the socket copies.
+		std::shared_ptr<compressor> _compressor;
+
 	public: // constructors and destructors
 		explicit
 		socket() = default;
@@ -90,11 +190,101 @@ namespace agoNetwork {
 		virtual void
 		send(const std::string&, const std::string&) noexcept;
 
+		/// @brief Send a message to the specified address with a header frame
+		/// between the empty delimiter and the message.
+		/// An empty header is not sent at all.
+		/// @see agoNetwork::envelope::encode
+		void
+		send(const std::string&, const std::string&, const std::string&)
+		noexcept;
+
+		/// @brief Send a batch of messages to the specified address, each
+		/// with the same header frame.
+		/// The frames are written straight from the views, no intermediate
+		/// string is made unless the batch is queued for the owner thread.
+		/// @return Number of the sent (or queued) messages.
+		std::size_t
+		sendBatch(
+				const std::string&,
+				const std::vector<std::string_view>&,
+				const std::string&) noexcept;
+
+		/// @brief Send a message whose bytes belong to the specified owner
+		/// without copying them, e.g. a region of a mapped file.
+		/// The owner is kept alive until zmq is done with the bytes.
+		/// Messages which are queued for the owner thread, observed or
+		/// compressed are copied.
+		void
+		sendShared(
+				const std::string&,
+				std::shared_ptr<const void>,
+				std::string_view,
+				const std::string&) noexcept;
+
 		/// @brief Receives a message.
+		/// A header frame, if any, is appended to the received message.
+		/// A connect or disconnect notification of a router peer
+		/// (ZMQ_ROUTER_NOTIFY) is received as the peer address alone.
 		/// @return The received message.
 		virtual std::vector<std::string>
 		receive() noexcept;
 
+		/// @brief Receives a message into a reusable buffer, the frames are
+		/// laid out as socket::receive returns them.
+		/// Each frame is copied straight from the zmq message into the
+		/// buffer, so nothing is allocated once the buffer is large enough.
+		/// @return true if a message is received, false if nothing is
+		/// received or the message is dropped, e.g. since it does not fit
+		/// (see frameBuffer::truncated).
+		bool
+		receive(frameBuffer&) noexcept;
+
+	protected: // protected methods
+		/// @brief Specify whether more frames of the current message are
+		/// waiting to be received.
+		/// @return true if there are more frames and false otherwise.
+		[[nodiscard]]
+		bool
+		more_() const noexcept;
+
+		/// @brief Discard the remaining frames of the current message.
+		void
+		drain_() noexcept;
+
+		/// @brief Receive a frame of the current message into the buffer.
+		/// @throw zmq::error_t if receiving fails.
+		/// @return false if nothing is received or the frame does not fit.
+		bool
+		receiveFrame_(frameBuffer&);
+
+		/// @brief Decompress a received message if its header says so.
+		/// @return false if the message could not be decompressed.
+		bool
+		inflate_(std::string&, const std::string&) noexcept;
+
+		/// @brief Decompress the message frame of a buffer, which is
+		/// followed by its header frame, if the header says so.
+		/// @return false if the message could not be decompressed.
+		bool
+		inflate_(frameBuffer&, std::size_t) noexcept;
+
+		/// @brief Specify whether the socket type is supposed to bind.
+		/// Routers always bind, pipeline sockets could either bind or connect.
+		/// @return true if the socket could be bound and false otherwise.
+		[[nodiscard]]
+		bool
+		bindable_() const noexcept;
+
+		/// @brief Specify whether the socket type is supposed to connect.
+		/// Dealers always connect, pipeline sockets could either bind or
+		/// connect.
+		/// @return true if the socket could be connected and false otherwise.
+		[[nodiscard]]
+		bool
+		connectable_() const noexcept;
+
+	public:
+
 		/// @brief Specify the socket name.
 		/// @return The socket name.
 		virtual std::string
@@ -104,6 +294,51 @@ namespace agoNetwork {
 		/// @return The socket address.
 		virtual std::string
 		address() noexcept;
+
+		/// @brief Make the calling thread the owner of the socket.
+		/// socket::send called by any other thread is queued afterwards
+		/// and the specified function is called to wake the owner up.
+		void
+		own(std::function<void()>) noexcept;
+
+		/// @brief Send the messages queued by the other threads.
+		/// @note It must be called by the owner thread.
+		void
+		flush() noexcept;
+
+		/// @brief Send the messages queued by the other threads and make the
+		/// socket not owned anymore, e.g. once its poll loop returns.
+		/// @note It must be called by the owner thread or once the owner
+		/// thread and the threads which queue messages are gone.
+		void
+		disown() noexcept;
+
+		/// @brief Drop the messages queued by the other threads for the
+		/// specified address, e.g. once its peer is dead.
+		/// @return Number of the dropped messages.
+		std::size_t
+		purge(const std::string&) noexcept;
+
+		/// @brief Configure the heartbeats of the connections.
+		/// Dead connections are closed together with their queued messages,
+		/// and a dealer queues nothing to an incomplete connection.
+		/// @note It should be called before the socket binds or connects.
+		void
+		heartbeat(const socketModel::heartbeat&) noexcept;
+
+		/// @brief Compress the messages of a router or dealer socket which
+		/// are long enough and do shrink.
+		/// Compressed messages are flagged in the header frame, so they
+		/// are decompressed by any socket of this library.
+		/// @note It should be called before the socket is polled.
+		void
+		compress(std::shared_ptr<compressor>) noexcept;
+
+		/// @brief Specify the compressor of the socket.
+		/// @return The compressor or nullptr if the socket does not compress.
+		[[nodiscard]]
+		std::shared_ptr<compressor>
+		compression() const noexcept;
 	};
 
 	/// @brief **agoNetwork::tcpSocket**
@@ -143,6 +378,28 @@ namespace agoNetwork {
 
 		std::string
 		address() noexcept override;
+
+		using socket::send;
+
+		using socket::receive;
+
+		using socket::sendBatch;
+
+		using socket::sendShared;
+
+		using socket::own;
+
+		using socket::flush;
+
+		using socket::disown;
+
+		using socket::purge;
+
+		using socket::heartbeat;
+
+		using socket::compress;
+
+		using socket::compression;
 	};
 
 	/// @brief **agoNetwork::ipcSocket**
@@ -179,6 +436,28 @@ namespace agoNetwork {
 
 		std::string
 		address() noexcept override;
+
+		using socket::send;
+
+		using socket::receive;
+
+		using socket::sendBatch;
+
+		using socket::sendShared;
+
+		using socket::own;
+
+		using socket::flush;
+
+		using socket::disown;
+
+		using socket::purge;
+
+		using socket::heartbeat;
+
+		using socket::compress;
+
+		using socket::compression;
 	};
 
 	/// @brief **agoNetwork::inprocSocket**
@@ -215,6 +494,28 @@ namespace agoNetwork {
 
 		std::string
 		address() noexcept override;
+
+		using socket::send;
+
+		using socket::receive;
+
+		using socket::sendBatch;
+
+		using socket::sendShared;
+
+		using socket::own;
+
+		using socket::flush;
+
+		using socket::disown;
+
+		using socket::purge;
+
+		using socket::heartbeat;
+
+		using socket::compress;
+
+		using socket::compression;
 	};
 }
 
@@ -223,12 +524,14 @@ namespace agoNetwork::socketModel {
 	public:
 		std::string name;
 		std::string address;
+		agoNetwork::socketModel::heartbeat heartbeat{};
 	};
 
 	class ipc {
 	public:
 		std::string name;
 		std::string address;
+		agoNetwork::socketModel::heartbeat heartbeat{};
 	};
 
 	class inproc {
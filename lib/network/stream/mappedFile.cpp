@@ -0,0 +1,57 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:18
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <lib/network/stream/mappedFile.h>
+
+namespace agoNetwork {
+	mappedFile::
+	mappedFile(const std::string& path) noexcept {
+		const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (descriptor<0) {
+			return;
+		}
+		struct stat status{};
+		if (::fstat(descriptor, &status)==0) {
+			_size = static_cast<std::size_t>(status.st_size);
+			if (_size==0) {
+				// an empty file could not be mapped, nor does it need to be
+				_valid = true;
+			}
+			else if (auto data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+					data!=MAP_FAILED) {
+				// the file is read front to back once
+				::madvise(data, _size, MADV_SEQUENTIAL);
+				_data = data;
+				_valid = true;
+			}
+		}
+		// the mapping outlives the descriptor
+		::close(descriptor);
+	}
+
+	mappedFile::
+	~mappedFile() {
+		if (_data) {
+			::munmap(_data, _size);
+		}
+	}
+
+	bool mappedFile::
+	valid() const noexcept {
+		return _valid;
+	}
+
+	std::string_view mappedFile::
+	view() const noexcept {
+		return _data
+				? std::string_view{ static_cast<const char*>(_data), _size }
+				: std::string_view{};
+	}
+}
@@ -0,0 +1,50 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:18
+//
+
+#ifndef AGO_NETWORK_MAPPED_FILE_H
+#define AGO_NETWORK_MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+
+namespace agoNetwork {
+	/// @brief **mappedFile** maps a file read only into memory, so its
+	/// regions are sent without being read or copied.
+	/// @see dealer::streamFile
+	class mappedFile final {
+	private: // private data
+		void* _data{ nullptr };
+		std::size_t _size{ 0 };
+		bool _valid{ false };
+
+	public: // constructors and destructors
+		/// @brief Map the file of the specified path.
+		/// @see mappedFile::valid
+		explicit
+		mappedFile(const std::string&) noexcept;
+
+		mappedFile(const mappedFile&) = delete;
+
+		mappedFile&
+		operator=(const mappedFile&) = delete;
+
+		/// @brief Unmap the file.
+		~mappedFile();
+
+	public: // public methods
+		/// @brief Specify whether the file is mapped.
+		[[nodiscard]]
+		bool
+		valid() const noexcept;
+
+		/// @brief View the mapped file.
+		[[nodiscard]]
+		std::string_view
+		view() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_MAPPED_FILE_H
@@ -0,0 +1,54 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 20:18
+//
+
+#ifndef AGO_NETWORK_STREAM_H
+#define AGO_NETWORK_STREAM_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace agoNetwork {
+	/// @brief A chunk of a streamed payload as the router receives it.
+	/// @see dealer::stream and router::registerStream
+	struct streamChunk {
+		/// Identifies the stream among the streams of the same dealer.
+		std::uint64_t stream{ 0 };
+		/// Offset of the chunk in the payload.
+		std::uint64_t offset{ 0 };
+		/// Size of the whole payload.
+		std::uint64_t total{ 0 };
+		/// The bytes of the chunk, valid while the callback runs.
+		std::string_view data;
+
+		/// @brief Specify whether the chunk is the last of its payload.
+		[[nodiscard]]
+		bool
+		last() const noexcept {
+			return offset+data.size()>=total;
+		}
+	};
+
+	/// @brief streamCallback is a function alias which gets the client
+	/// address and a chunk of its stream.
+	using streamCallback =
+	std::function<void(const std::string&, const streamChunk&)>;
+
+	/// @brief Options of a streamed payload.
+	struct streamOptions {
+		/// Size of each chunk in bytes.
+		std::size_t chunk{ 1u << 20 };
+		/// Number of the chunks sent ahead of the credits of the router,
+		/// so at most window chunks are in flight.
+		std::uint32_t window{ 8 };
+		/// How long a credit is waited for before the stream fails.
+		std::chrono::milliseconds timeout{ 5000 };
+	};
+}
+
+#endif //AGO_NETWORK_STREAM_H
@@ -0,0 +1,46 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:15
+//
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <lib/network/wakeup/wakeup.h>
+
+namespace agoNetwork {
+	wakeup::
+	wakeup() noexcept {
+		if (::pipe(_pipe)==0) {
+			::fcntl(_pipe[0], F_SETFL, ::fcntl(_pipe[0], F_GETFL) | O_NONBLOCK);
+			::fcntl(_pipe[1], F_SETFL, ::fcntl(_pipe[1], F_GETFL) | O_NONBLOCK);
+		}
+	}
+
+	wakeup::
+	~wakeup() {
+		for (const auto end : _pipe) {
+			if (end>=0) {
+				::close(end);
+			}
+		}
+	}
+
+	int wakeup::
+	fd() const noexcept {
+		return _pipe[0];
+	}
+
+	void wakeup::
+	notify() const noexcept {
+		// a full pipe means a notification is already pending
+		const char byte{ 0 };
+		[[maybe_unused]] const auto _ = ::write(_pipe[1], &byte, 1);
+	}
+
+	void wakeup::
+	drain() const noexcept {
+		char buffer[64];
+		while (::read(_pipe[0], buffer, sizeof(buffer))>0) { }
+	}
+}
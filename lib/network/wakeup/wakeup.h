@@ -0,0 +1,50 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 19:15
+//
+
+#ifndef AGO_NETWORK_WAKEUP_H
+#define AGO_NETWORK_WAKEUP_H
+
+namespace agoNetwork {
+	/// @brief **wakeup** is a self pipe which wakes a poll loop up.
+	/// Its read end is polled next to the zmq sockets as a raw file
+	/// descriptor and any thread could notify it.
+	class wakeup final {
+	private: // private data
+		/// Read and write ends of the pipe.
+		int _pipe[2]{ -1, -1 };
+
+	public: // constructors and destructors
+		/// @brief Open a non-blocking pipe.
+		explicit
+		wakeup() noexcept;
+
+		wakeup(const wakeup&) = delete;
+
+		wakeup&
+		operator=(const wakeup&) = delete;
+
+		/// @brief Close the pipe.
+		~wakeup();
+
+	public: // public methods
+		/// @brief Specify the file descriptor which should be polled.
+		/// @return The read end of the pipe.
+		[[nodiscard]]
+		int
+		fd() const noexcept;
+
+		/// @brief Wake the poll loop up.
+		/// It could be called from any thread.
+		void
+		notify() const noexcept;
+
+		/// @brief Consume all the notifications.
+		void
+		drain() const noexcept;
+	};
+}
+
+#endif //AGO_NETWORK_WAKEUP_H
@@ -10,9 +10,16 @@
 namespace agoNetwork {
 	zmqContext::zmqContext(unsigned int io_thread)
 	noexcept
-			:_context{ static_cast<int>(io_thread) } { }
+			:_contextHandle{
+			std::make_shared<zmq::context_t>(static_cast<int>(io_thread)) },
+			 _context{ *_contextHandle } { }
 
 	zmqContext::zmqContext()
 	noexcept
-			:_context{ 1 } { }
+			:zmqContext{ 1 } { }
+
+	zmqContext::zmqContext(std::shared_ptr<zmq::context_t> context)
+	noexcept
+			:_contextHandle{ std::move(context) },
+			 _context{ *_contextHandle } { }
 }
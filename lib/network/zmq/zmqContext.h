@@ -8,6 +8,7 @@
 #ifndef AGO_NETWORK_ZMQ_SOCKET_H
 #define AGO_NETWORK_ZMQ_SOCKET_H
 
+#include <memory>
 #include <zmq.hpp>
 
 namespace agoNetwork {
@@ -16,8 +17,12 @@ namespace agoNetwork {
 	/// that wants to communicate with zmq sockets.
 	class zmqContext {
 	protected: // protected data
+		/// @brief Shared handle of the ZMQ context.
+		/// inproc sockets only talk to each other within the same context,
+		/// so the context could be shared between several adapters.
+		std::shared_ptr<zmq::context_t> _contextHandle;
 		/// @brief ZMQ Context witch is use for I/O communication
-		zmq::context_t _context;
+		zmq::context_t& _context;
 
 	public: // constructors and destructors
 		/// @brief Initialize context to use 1 thread for I/O communication
@@ -29,9 +34,16 @@ namespace agoNetwork {
 		explicit
 		zmqContext(unsigned int) noexcept;
 
-		/// @brief Close the context
+		/// @brief Use an already initialized context
+		/// which is shared with other adapters.
+		explicit
+		zmqContext(std::shared_ptr<zmq::context_t>) noexcept;
+
+		/// @brief Close the context if it is not shared anymore
 		~zmqContext() {
-			_context.close();
+			if (_contextHandle.use_count()==1) {
+				_context.close();
+			}
 		}
 	};
 }
@@ -0,0 +1,130 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:20
+//
+
+#include <deque>
+#include <tests/check.h>
+#include <lib/network/admission/admission.h>
+
+using namespace agoNetwork;
+
+namespace {
+	using verdict = admission::verdict;
+
+	void
+	reject() {
+		admission limits{ { "a", "b" }, 2, 0, overloadPolicy::reject, "BUSY" };
+		auto first = limits.offer("a", {}, {});
+		auto second = limits.offer("a", {}, {});
+		AGO_CHECK(first.first==verdict::admitted && second.first==verdict::admitted);
+		AGO_CHECK(limits.depth("a")==2 && limits.full("a") && limits.socketFull("a"));
+		// the third one is rejected, the busy reply is up to the caller
+		const auto third = limits.offer("a", {}, {});
+		AGO_CHECK(third.first==verdict::rejected && not third.second);
+		AGO_CHECK(limits.busyReply()=="BUSY");
+		// the other socket has a limit of its own
+		const auto other = limits.offer("b", {}, {});
+		AGO_CHECK(other.first==verdict::admitted);
+		AGO_CHECK(limits.stats().inflight==3 && limits.stats().rejected==1);
+		// a released ticket makes room again
+		first.second.reset();
+		AGO_CHECK(limits.depth("a")==1 && not limits.full("a"));
+		AGO_CHECK(limits.offer("a", {}, {}).first==verdict::admitted);
+		AGO_CHECK(limits.stats().inflight==2);
+		// an unknown socket is never counted
+		AGO_CHECK(not limits.offer("c", {}, {}).second);
+		AGO_CHECK(limits.depth("c")==0);
+	}
+
+	void
+	dropOldest() {
+		admission limits{ { "a", "b" }, 1, 0, overloadPolicy::dropOldest, "BUSY" };
+		// stands in for the queues of the lanes
+		std::deque<std::pair<std::string, std::shared_ptr<void>>> queued;
+		std::vector<std::string> evicted;
+		const auto evictOldest = [&](const std::string& group) {
+			for (auto entry = queued.begin(); entry!=queued.end(); ++entry) {
+				if (group.empty() || entry->first==group) {
+					evicted.push_back(group);
+					queued.erase(entry);
+					return true;
+				}
+			}
+			return false;
+		};
+		auto first = limits.offer("a", evictOldest, {});
+		AGO_CHECK(first.first==verdict::admitted);
+		queued.emplace_back("a", std::move(first.second));
+		// the queued request of the socket makes room for the new one
+		auto second = limits.offer("a", evictOldest, {});
+		AGO_CHECK(second.first==verdict::admitted);
+		AGO_CHECK((evicted==std::vector<std::string>{ "a" }) && queued.empty());
+		AGO_CHECK(limits.depth("a")==1 && limits.stats().dropped==1);
+		// nothing is queued (the request runs), so the new one is dropped
+		const auto third = limits.offer("a", evictOldest, {});
+		AGO_CHECK(third.first==verdict::dropped && not third.second);
+		AGO_CHECK(limits.stats().dropped==2 && limits.depth("a")==1);
+
+		// once only the global limit is hit any socket makes room
+		admission global{ { "a", "b" }, 0, 2, overloadPolicy::dropOldest, "BUSY" };
+		evicted.clear();
+		for (const auto* name : { "a", "a" }) {
+			auto admitted = global.offer(name, evictOldest, {});
+			queued.emplace_back(name, std::move(admitted.second));
+		}
+		AGO_CHECK(global.stats().inflight==2 && global.full("b") && not global.socketFull("b"));
+		auto last = global.offer("b", evictOldest, {});
+		AGO_CHECK(last.first==verdict::admitted);
+		AGO_CHECK((evicted==std::vector<std::string>{ "" }));
+		AGO_CHECK(global.depth("a")==1 && global.depth("b")==1 && global.stats().inflight==2);
+	}
+
+	void
+	backpressure() {
+		admission limits{ { "a" }, 1, 0, overloadPolicy::backpressure, "BUSY" };
+		int released{ 0 };
+		auto first = limits.offer("a", {}, [&] { ++released; });
+		AGO_CHECK(first.first==verdict::admitted);
+		AGO_CHECK(limits.paused("a"));
+		// what is received while paused is still admitted
+		auto second = limits.offer("a", {}, [&] { ++released; });
+		AGO_CHECK(second.first==verdict::admitted && limits.depth("a")==2);
+		AGO_CHECK(limits.stats().rejected==0 && limits.stats().dropped==0);
+		first.second.reset();
+		AGO_CHECK(released==1 && limits.paused("a"));
+		second.second.reset();
+		AGO_CHECK(released==2 && not limits.paused("a"));
+		// the other policies never pause
+		admission rejecting{ { "a" }, 1, 0, overloadPolicy::reject, "BUSY" };
+		const auto ticket = rejecting.offer("a", {}, {});
+		AGO_CHECK(rejecting.full("a") && not rejecting.paused("a"));
+	}
+
+	void
+	replaced() {
+		// router::limitInflight replaces the admission while its tickets
+		// are still around
+		auto limits = std::make_shared<admission>(
+				std::vector<std::string>{ "a" }, 4, 8, overloadPolicy::reject, "BUSY");
+		const std::weak_ptr<admission> previous = limits;
+		int released{ 0 };
+		auto ticket = limits->offer("a", {}, [&] { ++released; }).second;
+		limits = std::make_shared<admission>(
+				std::vector<std::string>{ "a" }, 4, 8, overloadPolicy::reject, "BUSY");
+		AGO_CHECK(not previous.expired());
+		AGO_CHECK(previous.lock()->depth("a")==1 && limits->depth("a")==0);
+		ticket.reset();
+		AGO_CHECK(released==1 && previous.expired());
+	}
+}
+
+int
+main() {
+	reject();
+	dropOldest();
+	backpressure();
+	replaced();
+	return test::result();
+}
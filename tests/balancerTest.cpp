@@ -0,0 +1,155 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 11:55
+//
+
+#include <set>
+#include <thread>
+#include <tests/check.h>
+#include <lib/network/balancer/balancer.h>
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	/// @brief Find what is observed of an endpoint.
+	balancer::endpoint
+	observed(const balancer& _balancer, const std::string& name) {
+		for (const auto& _endpoint : _balancer.endpoints()) {
+			if (_endpoint.name==name) {
+				return _endpoint;
+			}
+		}
+		return {};
+	}
+
+	void
+	roundRobin() {
+		balancer _balancer{ { "a", "b", "c" }, balancePolicy::roundRobin };
+		std::string picked;
+		for (int index{ 0 }; index<6; ++index) {
+			picked += _balancer.pick().value_or("");
+		}
+		AGO_CHECK(picked=="abcabc");
+		// the excepted endpoint is skipped unless it is the only one
+		for (int index{ 0 }; index<4; ++index) {
+			AGO_CHECK(_balancer.pick("b")!="b");
+		}
+		balancer single{ { "a" }, balancePolicy::roundRobin };
+		AGO_CHECK(single.pick("a")=="a");
+		balancer empty{ {}, balancePolicy::roundRobin };
+		AGO_CHECK(not empty.pick());
+	}
+
+	void
+	leastOutstanding() {
+		balancer _balancer{ { "a", "b", "c" }, balancePolicy::leastOutstanding };
+		_balancer.sent("a");
+		_balancer.sent("a");
+		_balancer.sent("b");
+		AGO_CHECK(_balancer.pick()=="c");
+		_balancer.sent("c");
+		_balancer.sent("c");
+		_balancer.sent("c");
+		AGO_CHECK(_balancer.pick()=="b");
+		_balancer.replied("a", 100us);
+		_balancer.replied("a", 100us);
+		AGO_CHECK(_balancer.pick()=="a");
+		AGO_CHECK(observed(_balancer, "a").outstanding==0);
+		// the idle endpoints share the load in turn
+		balancer idle{ { "a", "b" }, balancePolicy::leastOutstanding };
+		std::set<std::string> picked;
+		for (int index{ 0 }; index<4; ++index) {
+			picked.insert(idle.pick().value_or(""));
+		}
+		AGO_CHECK(picked.size()==2);
+	}
+
+	void
+	powerOfTwo() {
+		balancer _balancer{ { "a", "b", "c" }, balancePolicy::powerOfTwo };
+		_balancer.sent("a");
+		_balancer.replied("a", 10000us);
+		_balancer.sent("b");
+		_balancer.replied("b", 100us);
+		_balancer.sent("c");
+		_balancer.replied("c", 100us);
+		AGO_CHECK(observed(_balancer, "a").latency==10000us);
+		// the slow endpoint loses to either of the others
+		std::set<std::string> picked;
+		for (int index{ 0 }; index<100; ++index) {
+			picked.insert(_balancer.pick().value_or(""));
+		}
+		AGO_CHECK((picked==std::set<std::string>{ "b", "c" }));
+		// the latency is a moving average of the replies
+		_balancer.sent("b");
+		_balancer.replied("b", 600us);
+		AGO_CHECK(observed(_balancer, "b").latency==200us);
+		// and the outstanding requests multiply it, so the slow endpoint
+		// beats the busy ones and the busiest one is never picked
+		for (int index{ 0 }; index<200; ++index) {
+			_balancer.sent("b");
+			_balancer.sent("c");
+		}
+		picked.clear();
+		for (int index{ 0 }; index<100; ++index) {
+			picked.insert(_balancer.pick().value_or(""));
+		}
+		AGO_CHECK((picked==std::set<std::string>{ "a", "c" }));
+	}
+
+	void
+	ejection() {
+		balancer _balancer{
+				{ "a", "b" }, balancePolicy::roundRobin, { 2, 30ms, 50ms, 5000ms }};
+		_balancer.sent("a");
+		_balancer.failed("a");
+		AGO_CHECK(observed(_balancer, "a").failures==1);
+		_balancer.sent("a");
+		_balancer.failed("a");
+		AGO_CHECK(observed(_balancer, "a").ejections==1 && observed(_balancer, "a").probing);
+		for (int index{ 0 }; index<4; ++index) {
+			AGO_CHECK(_balancer.pick()=="b");
+		}
+		// once the ejection is over it takes a single probe
+		std::this_thread::sleep_for(40ms);
+		AGO_CHECK(_balancer.pick("b")=="a");
+		_balancer.sent("a");
+		for (int index{ 0 }; index<4; ++index) {
+			AGO_CHECK(_balancer.pick()=="b");
+		}
+		// a failed probe ejects it for twice as long, within the maximum
+		const auto failedAt = balancer::clock::now();
+		_balancer.failed("a");
+		const auto until = observed(_balancer, "a").ejectedUntil;
+		AGO_CHECK(observed(_balancer, "a").ejections==2);
+		AGO_CHECK(until>=failedAt+50ms && until<failedAt+60ms);
+		// a successful probe brings it back
+		std::this_thread::sleep_for(60ms);
+		AGO_CHECK(_balancer.pick("b")=="a");
+		_balancer.sent("a");
+		_balancer.replied("a", 100us);
+		AGO_CHECK(not observed(_balancer, "a").probing && observed(_balancer, "a").ejections==0);
+		std::set<std::string> picked;
+		for (int index{ 0 }; index<4; ++index) {
+			picked.insert(_balancer.pick().value_or(""));
+		}
+		AGO_CHECK(picked.size()==2);
+		// with every endpoint ejected they are all picked from anyway
+		for (const auto* name : { "a", "a", "b", "b" }) {
+			_balancer.sent(name);
+			_balancer.failed(name);
+		}
+		AGO_CHECK(_balancer.pick().has_value());
+	}
+}
+
+int
+main() {
+	roundRobin();
+	leastOutstanding();
+	powerOfTwo();
+	ejection();
+	return test::result();
+}
@@ -0,0 +1,36 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:19
+//
+
+#ifndef AGO_NETWORK_TESTS_CHECK_H
+#define AGO_NETWORK_TESTS_CHECK_H
+
+#include <iostream>
+
+namespace agoNetwork::test {
+	/// Number of the failed checks of the test.
+	inline int failures{ 0 };
+
+	/// @brief Report a failed check, the test goes on.
+	inline void
+	check(bool passed, const char* expression, const char* file, int line) {
+		if (not passed) {
+			++failures;
+			std::cerr << file << ':' << line << ": check failed: " << expression << '\n';
+		}
+	}
+
+	/// @brief Specify the exit code of the test.
+	inline int
+	result() {
+		return failures==0 ? 0 : 1;
+	}
+}
+
+/// Check a condition of a test.
+#define AGO_CHECK(condition) \
+	agoNetwork::test::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+#endif //AGO_NETWORK_TESTS_CHECK_H
@@ -0,0 +1,75 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 11:40
+//
+
+#include <thread>
+#include <tests/check.h>
+#include <lib/network/breaker/circuitBreaker.h>
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	void
+	opens() {
+		circuitBreaker breaker{ { 3, 50ms, 1, 5000ms } };
+		AGO_CHECK(breaker.stats().state==circuitState::closed);
+		// a success in between starts the count over
+		breaker.failure();
+		breaker.failure();
+		breaker.success();
+		breaker.failure();
+		breaker.failure();
+		AGO_CHECK(breaker.allow() && breaker.stats().state==circuitState::closed);
+		breaker.failure();
+		AGO_CHECK(breaker.stats().state==circuitState::open && breaker.stats().opened==1);
+		// an open circuit fails fast
+		AGO_CHECK(not breaker.allow() && not breaker.allow());
+		AGO_CHECK(breaker.stats().rejected==2);
+	}
+
+	void
+	halfOpen() {
+		circuitBreaker breaker{ { 1, 20ms, 2, 5000ms } };
+		breaker.failure();
+		AGO_CHECK(not breaker.allow());
+		std::this_thread::sleep_for(40ms);
+		// once the open period is over only the probes are let through
+		AGO_CHECK(breaker.allow() && breaker.stats().state==circuitState::halfOpen);
+		AGO_CHECK(breaker.allow() && not breaker.allow());
+		// a cancelled probe gives its place back
+		breaker.cancel();
+		AGO_CHECK(breaker.allow());
+		// it takes every probe to close the circuit
+		breaker.success();
+		AGO_CHECK(breaker.stats().state==circuitState::halfOpen);
+		breaker.success();
+		AGO_CHECK(breaker.stats().state==circuitState::closed && breaker.allow());
+	}
+
+	void
+	reopens() {
+		circuitBreaker breaker{ { 1, 20ms, 1, 5000ms } };
+		breaker.failure();
+		std::this_thread::sleep_for(40ms);
+		AGO_CHECK(breaker.allow() && breaker.stats().state==circuitState::halfOpen);
+		// a failed probe opens the circuit for another period
+		breaker.failure();
+		AGO_CHECK(breaker.stats().state==circuitState::open && breaker.stats().opened==2);
+		AGO_CHECK(not breaker.allow());
+		std::this_thread::sleep_for(40ms);
+		AGO_CHECK(breaker.allow());
+		breaker.success();
+		AGO_CHECK(breaker.stats().state==circuitState::closed);
+	}
+}
+
+int
+main() {
+	opens();
+	halfOpen();
+	reopens();
+	return test::result();
+}
@@ -0,0 +1,91 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 10:40
+//
+
+#include <tests/check.h>
+#include <lib/network/coalescer/coalescer.h>
+
+using namespace agoNetwork;
+
+namespace {
+	/// @brief The replies sent to the waiters, by identity.
+	using sent = std::vector<std::pair<std::string, std::string>>;
+
+	coalescer::sender
+	recorder(sent& replies) {
+		return [&replies](const coalescer::waiter& waiter, const std::string& reply) {
+			replies.emplace_back(waiter.identity+"|"+waiter.header, reply);
+		};
+	}
+
+	void
+	fanOut() {
+		coalescer flights;
+		AGO_CHECK(not flights.enabled("s"));
+		flights.enable("s");
+		AGO_CHECK(flights.enabled("s"));
+		AGO_CHECK(flights.join("s", "quote", "leader"));
+		// identical payloads join, others lead flights of their own
+		AGO_CHECK(not flights.join("s", "quote", "w1", "h1"));
+		AGO_CHECK(not flights.join("s", "quote", "w2", "h2"));
+		AGO_CHECK(flights.join("s", "order", "other"));
+		AGO_CHECK(flights.join("t", "quote", "elsewhere"));
+		AGO_CHECK(flights.coalesced()==2);
+		auto replies = std::make_shared<std::vector<std::string>>();
+		auto ran = std::make_shared<bool>(false);
+		sent received;
+		auto flight = flights.flight("s", "quote", replies, ran, "BUSY", recorder(received));
+		// the callbacks of the leader run
+		replies->push_back("one");
+		replies->push_back("two");
+		*ran = true;
+		AGO_CHECK(received.empty());
+		flight.reset();
+		AGO_CHECK((received==sent{
+				{ "w1|h1", "one" }, { "w1|h1", "two" },
+				{ "w2|h2", "one" }, { "w2|h2", "two" }}));
+		// once landed the payload leads a new flight
+		AGO_CHECK(flights.join("s", "quote", "late"));
+		AGO_CHECK(flights.land("s", "quote").empty());
+	}
+
+	void
+	releasedLeader() {
+		coalescer flights;
+		flights.enable("s");
+		AGO_CHECK(flights.join("s", "quote", "leader"));
+		AGO_CHECK(not flights.join("s", "quote", "w1"));
+		AGO_CHECK(not flights.join("s", "quote", "w2"));
+		sent received;
+		{
+			// the leader is dropped from its lane (or expires) before its
+			// callbacks run, the last copy of its flight goes with it
+			auto flight = flights.flight("s", "quote",
+					std::make_shared<std::vector<std::string>>(),
+					std::make_shared<bool>(false),
+					"BUSY", recorder(received));
+			auto queued = flight;
+		}
+		AGO_CHECK((received==sent{ { "w1|", "BUSY" }, { "w2|", "BUSY" }}));
+		// a leader which ran without replying leaves its waiters without
+		// replies as well
+		AGO_CHECK(flights.join("s", "quote", "leader"));
+		AGO_CHECK(not flights.join("s", "quote", "w3"));
+		received.clear();
+		flights.flight("s", "quote",
+				std::make_shared<std::vector<std::string>>(),
+				std::make_shared<bool>(true),
+				"BUSY", recorder(received)).reset();
+		AGO_CHECK(received.empty());
+		AGO_CHECK(flights.join("s", "quote", "next"));
+	}
+}
+
+int
+main() {
+	fanOut();
+	releasedLeader();
+	return test::result();
+}
@@ -0,0 +1,143 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 23:30
+//
+
+#include <tests/check.h>
+#include <lib/network/codec/varintCodec.h>
+
+using namespace agoNetwork;
+
+namespace {
+	enum class side : std::uint8_t {
+		buy,
+		sell
+	};
+
+	struct order {
+		std::uint64_t id{ 0 };
+		std::int32_t quantity{ 0 };
+		double price{ 0 };
+		side direction{ side::buy };
+		bool limit{ false };
+		std::string symbol;
+		static constexpr auto fields = std::make_tuple(
+				&order::id, &order::quantity, &order::price,
+				&order::direction, &order::limit, &order::symbol);
+	};
+
+	/// @brief The first version of the order, before it had a direction.
+	struct legacyOrder {
+		std::uint64_t id{ 0 };
+		std::int32_t quantity{ 0 };
+		double price{ 0 };
+		static constexpr auto fields = std::make_tuple(
+				&legacyOrder::id, &legacyOrder::quantity, &legacyOrder::price);
+	};
+
+	struct quote {
+		std::uint8_t level{ 0 };
+		std::string_view symbol;
+		static constexpr auto fields = std::make_tuple(&quote::level, &quote::symbol);
+	};
+
+	struct wide {
+		std::int64_t smallest{ 0 };
+		std::int64_t largest{ 0 };
+		std::uint64_t unsignedLargest{ 0 };
+		static constexpr auto fields = std::make_tuple(
+				&wide::smallest, &wide::largest, &wide::unsignedLargest);
+	};
+
+	static_assert(varintSchema<order> && not varintSchema<int>);
+
+	void
+	roundTrip() {
+		const order sent{ .id = 1ull << 40, .quantity = -7, .price = 42.125,
+				.direction = side::sell, .limit = true, .symbol = "AGO" };
+		std::string frame;
+		varintCodec<order>::encode(sent, frame);
+		// six bytes of id, one of quantity, eight of price, one of each flag
+		// and four of symbol
+		AGO_CHECK(frame.size()==6+1+8+1+1+4);
+		const auto received = varintCodec<order>::decode(frame);
+		AGO_CHECK(received);
+		if (received) {
+			AGO_CHECK(received->id==sent.id && received->quantity==sent.quantity);
+			AGO_CHECK(received->price==sent.price && received->direction==sent.direction);
+			AGO_CHECK(received->limit && received->symbol=="AGO");
+		}
+		// the buffer is replaced, not appended to
+		varintCodec<order>::encode(order{}, frame);
+		AGO_CHECK(frame.size()==1+1+8+1+1+1);
+	}
+
+	void
+	extremes() {
+		const wide sent{ std::numeric_limits<std::int64_t>::min(),
+				std::numeric_limits<std::int64_t>::max(),
+				std::numeric_limits<std::uint64_t>::max() };
+		std::string frame;
+		varintCodec<wide>::encode(sent, frame);
+		AGO_CHECK(frame.size()==30);
+		const auto received = varintCodec<wide>::decode(frame);
+		AGO_CHECK(received && received->smallest==sent.smallest
+				&& received->largest==sent.largest
+				&& received->unsignedLargest==sent.unsignedLargest);
+	}
+
+	void
+	evolution() {
+		// a newer peer decodes the frame of an older one with defaults
+		std::string frame;
+		varintCodec<legacyOrder>::encode({ .id = 5, .quantity = 3, .price = 1.5 }, frame);
+		const auto upgraded = varintCodec<order>::decode(frame);
+		AGO_CHECK(upgraded && upgraded->id==5 && upgraded->quantity==3);
+		AGO_CHECK(upgraded && upgraded->direction==side::buy && upgraded->symbol.empty());
+		// an older peer ignores the fields it does not know
+		varintCodec<order>::encode({ .id = 6, .quantity = -1, .price = 2.5,
+				.direction = side::sell, .limit = false, .symbol = "AGO" }, frame);
+		const auto legacy = varintCodec<legacyOrder>::decode(frame);
+		AGO_CHECK(legacy && legacy->id==6 && legacy->quantity==-1 && legacy->price==2.5);
+	}
+
+	void
+	malformed() {
+		const order sent{ .id = 300, .quantity = 1, .price = 1, .direction = side::sell,
+				.limit = true, .symbol = "symbol" };
+		std::string frame;
+		varintCodec<order>::encode(sent, frame);
+		// a frame cut within a field is rejected, at a field boundary it is not
+		AGO_CHECK(not varintCodec<order>::decode(std::string_view{ frame }.substr(0, 1)));
+		AGO_CHECK(varintCodec<order>::decode(std::string_view{ frame }.substr(0, 2)));
+		AGO_CHECK(not varintCodec<order>::decode(std::string_view{ frame }.substr(0, 5)));
+		AGO_CHECK(not varintCodec<order>::decode(std::string_view{ frame }.substr(0, frame.size()-1)));
+		// values which do not fit their fields
+		AGO_CHECK(not varintCodec<quote>::decode("\x80\x02"));
+		AGO_CHECK(not varintCodec<order>::decode(std::string_view{ "\x01\x01\0\0\0\0\0\0\0\0\x01\x02", 12 }));
+		AGO_CHECK(not varintCodec<order>::decode("\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x02"));
+		// an empty frame is the default message
+		AGO_CHECK(varintCodec<order>::decode("") && varintCodec<order>::decode("")->id==0);
+	}
+
+	void
+	views() {
+		std::string frame;
+		varintCodec<quote>::encode({ .level = 3, .symbol = "AGO" }, frame);
+		const auto received = varintCodec<quote>::decode(frame);
+		AGO_CHECK(received && received->level==3 && received->symbol=="AGO");
+		// the symbol is not copied out of the frame
+		AGO_CHECK(received && received->symbol.data()==frame.data()+2);
+	}
+}
+
+int
+main() {
+	roundTrip();
+	extremes();
+	evolution();
+	malformed();
+	views();
+	return test::result();
+}
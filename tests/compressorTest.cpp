@@ -0,0 +1,143 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 22:40
+//
+
+#include <tests/check.h>
+#include <lib/network/compression/compressor.h>
+
+using namespace agoNetwork;
+
+namespace {
+	/// @brief A message which compresses well.
+	std::string
+	repetitive(std::size_t size) {
+		std::string message;
+		while (message.size()<size) {
+			message.append(R"({"symbol":"AGO","price":)");
+			message.append(std::to_string(message.size()%97));
+			message.append("},");
+		}
+		message.resize(size);
+		return message;
+	}
+
+	void
+	roundTrip() {
+		compressor _compressor{{ .algorithm = compression::lz, .threshold = 64,
+				.dictionary = {}, .level = 1, .maxSize = 1 << 20 }};
+		for (const auto size : { 64, 1000, 70000 }) {
+			const auto message = repetitive(size);
+			const auto compressed = _compressor.compress(message);
+			AGO_CHECK(compressed);
+			if (not compressed) {
+				continue;
+			}
+			AGO_CHECK(compressed->first==static_cast<std::uint8_t>(compression::lz));
+			AGO_CHECK(compressed->second.size()<message.size());
+			AGO_CHECK(_compressor.decompress(compressed->first, compressed->second)==message);
+		}
+		const auto stats = _compressor.stats();
+		AGO_CHECK(stats.compressed==3 && stats.decompressed==3 && stats.failed==0);
+		AGO_CHECK(stats.ratio()>1.0);
+	}
+
+	void
+	dictionary() {
+		const std::string shared{ R"({"symbol":"AGO","price":)" };
+		compressor _compressor{{ .algorithm = compression::lz, .threshold = 16,
+				.dictionary = shared, .level = 1, .maxSize = 1 << 20 }};
+		const std::string message{ R"({"symbol":"AGO","price":42})" };
+		const auto compressed = _compressor.compress(message);
+		AGO_CHECK(compressed);
+		if (compressed) {
+			AGO_CHECK(_compressor.decompress(compressed->first, compressed->second)==message);
+			// a compressor without the dictionary could not decompress it
+			compressor plain{};
+			AGO_CHECK(not plain.decompress(compressed->first, compressed->second));
+		}
+	}
+
+	void
+	limits() {
+		compressor _compressor{{ .algorithm = compression::lz, .threshold = 64,
+				.dictionary = {}, .level = 1, .maxSize = 1 << 20 }};
+		const auto message = repetitive(70000);
+		const auto compressed = _compressor.compress(message);
+		AGO_CHECK(compressed);
+		if (compressed) {
+			// a receiver with a smaller limit drops the message
+			compressor small{{ .algorithm = compression::lz, .threshold = 64,
+					.dictionary = {}, .level = 1, .maxSize = 1024 }};
+			AGO_CHECK(not small.decompress(compressed->first, compressed->second));
+		}
+		// a few bytes which claim a gigabyte are never allocated for
+		const std::string huge{ "\x80\x80\x80\x80\x04\x10" "a", 7 };
+		AGO_CHECK(not _compressor.decompress(static_cast<std::uint8_t>(compression::lz), huge));
+	}
+
+	void
+	malformed() {
+		compressor _compressor{};
+		const auto lz = static_cast<std::uint8_t>(compression::lz);
+		// five bytes, one literal and a match of four at distance one
+		AGO_CHECK(_compressor.decompress(lz, { "\x05\x10" "a" "\x01\x00", 5 })=="aaaaa");
+		// a match at distance zero or before the first byte
+		AGO_CHECK(not _compressor.decompress(lz, { "\x05\x10" "a" "\x00\x00", 5 }));
+		AGO_CHECK(not _compressor.decompress(lz, { "\x05\x10" "a" "\x02\x00", 5 }));
+		// more or fewer bytes than the claimed size
+		AGO_CHECK(not _compressor.decompress(lz, { "\x04\x10" "a" "\x01\x00", 5 }));
+		AGO_CHECK(not _compressor.decompress(lz, { "\x06\x10" "a" "\x01\x00", 5 }));
+		// a truncated offset, literals and size
+		AGO_CHECK(not _compressor.decompress(lz, { "\x05\x10" "a" "\x01", 4 }));
+		AGO_CHECK(not _compressor.decompress(lz, { "\x05\x30" "a", 3 }));
+		AGO_CHECK(not _compressor.decompress(lz, { "\x80", 1 }));
+		AGO_CHECK(not _compressor.decompress(lz, {}));
+		// a truncated message
+		const auto message = repetitive(1000);
+		const auto compressed = _compressor.compress(message);
+		AGO_CHECK(compressed);
+		if (compressed) {
+			for (const auto cut : { std::size_t{ 7 }, compressed->second.size()/2 }) {
+				const auto truncated = std::string_view{ compressed->second }.substr(0, compressed->second.size()-cut);
+				AGO_CHECK(not _compressor.decompress(compressed->first, truncated));
+			}
+		}
+		// garbage never reads out of bounds
+		std::string noise;
+		for (std::uint32_t state{ 7 }; noise.size()<4096;) {
+			state = state*1103515245+12345;
+			noise.push_back(static_cast<char>(state >> 24));
+			_compressor.decompress(lz, noise);
+		}
+	}
+
+	void
+	skipped() {
+		compressor _compressor{};
+		// shorter than the threshold
+		AGO_CHECK(not _compressor.compress("short"));
+		// does not shrink
+		std::string noise;
+		for (std::uint32_t state{ 1 }; noise.size()<1024;) {
+			state = state*1103515245+12345;
+			noise.push_back(static_cast<char>(state >> 24));
+		}
+		AGO_CHECK(not _compressor.compress(noise));
+		AGO_CHECK(_compressor.stats().skipped==2);
+		// an unknown algorithm is not decompressed
+		AGO_CHECK(not _compressor.decompress(0x7F, "anything"));
+		AGO_CHECK(_compressor.stats().failed==1);
+	}
+}
+
+int
+main() {
+	roundTrip();
+	dictionary();
+	limits();
+	malformed();
+	skipped();
+	return test::result();
+}
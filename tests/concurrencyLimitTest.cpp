@@ -0,0 +1,85 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 11:40
+//
+
+#include <tests/check.h>
+#include <lib/network/limiter/concurrencyLimit.h>
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	void
+	acquire() {
+		concurrencyLimit limit{ { 4, 2, 6, 0.5, 2.0 } };
+		for (int index{ 0 }; index<4; ++index) {
+			AGO_CHECK(limit.acquire());
+		}
+		AGO_CHECK(not limit.acquire());
+		AGO_CHECK(limit.stats().inflight==4 && limit.stats().rejected==1);
+		// a cancelled request leaves the limit as it is
+		limit.cancel();
+		AGO_CHECK(limit.stats().inflight==3 && limit.stats().limit==4);
+		AGO_CHECK(limit.acquire());
+		// the initial limit is kept within the bounds
+		concurrencyLimit clamped{ { 100, 2, 6, 0.5, 2.0 } };
+		AGO_CHECK(clamped.stats().limit==6);
+	}
+
+	void
+	increase() {
+		concurrencyLimit limit{ { 4, 2, 6, 0.5, 2.0 } };
+		for (int index{ 0 }; index<4; ++index) {
+			limit.acquire();
+		}
+		// one per limit replies, so a round of replies adds one
+		for (int index{ 0 }; index<5; ++index) {
+			limit.release(100us);
+			limit.acquire();
+		}
+		AGO_CHECK(limit.stats().limit==5 && limit.stats().minRtt==100us);
+		// it never goes beyond the maximum
+		for (int index{ 0 }; index<100; ++index) {
+			limit.release(100us);
+			limit.acquire();
+		}
+		AGO_CHECK(limit.stats().limit==6);
+		// an unused limit does not grow
+		concurrencyLimit idle{ { 4, 2, 6, 0.5, 2.0 } };
+		for (int index{ 0 }; index<100; ++index) {
+			idle.acquire();
+			idle.release(100us);
+		}
+		AGO_CHECK(idle.stats().limit==4 && idle.stats().inflight==0);
+	}
+
+	void
+	decrease() {
+		concurrencyLimit limit{ { 6, 2, 6, 0.5, 2.0 } };
+		// a failure backs off
+		limit.acquire();
+		limit.release(std::nullopt);
+		AGO_CHECK(limit.stats().limit==3);
+		// so does a reply beyond the tolerance of the shortest round trip
+		limit.acquire();
+		limit.release(100us);
+		AGO_CHECK(limit.stats().limit==3);
+		limit.acquire();
+		limit.release(1000us);
+		AGO_CHECK(limit.stats().limit==2 && limit.stats().minRtt==100us);
+		// not below the minimum though
+		limit.acquire();
+		limit.release(std::nullopt);
+		AGO_CHECK(limit.stats().limit==2 && limit.stats().inflight==0);
+	}
+}
+
+int
+main() {
+	acquire();
+	increase();
+	decrease();
+	return test::result();
+}
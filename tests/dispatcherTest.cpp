@@ -0,0 +1,104 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 09:30
+//
+
+#include <chrono>
+#include <map>
+#include <tests/check.h>
+#include <lib/network/dispatcher/dispatcher.h>
+#include <lib/network/numa/numaNode.h>
+
+namespace agoNetwork {
+	/// Stands in for the NUMA placement, the lanes of the tests are not
+	/// pinned.
+	bool numaNode::
+	pin(const std::vector<unsigned int>&) noexcept {
+		return false;
+	}
+}
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	void
+	ordered() {
+		std::map<std::string, std::vector<int>> ran;
+		const std::vector<std::string> keys{ "a", "b", "c", "d", "e", "f" };
+		for (const auto& key : keys) {
+			ran[key];
+		}
+		{
+			dispatcher lanes{ 3 };
+			AGO_CHECK(lanes.lanes()==3);
+			for (int task{ 0 }; task<1000; ++task) {
+				for (const auto& key : keys) {
+					// only the lane of the key touches its vector
+					lanes.dispatch(key, [&ran, key, task] { ran.at(key).push_back(task); });
+				}
+			}
+			// the queued tasks run before the lanes are joined
+		}
+		for (const auto& key : keys) {
+			const auto& tasks = ran.at(key);
+			AGO_CHECK(tasks.size()==1000);
+			AGO_CHECK(std::is_sorted(tasks.begin(), tasks.end()));
+		}
+	}
+
+	void
+	parallel() {
+		std::atomic<int> running{ 0 };
+		std::atomic<int> peak{ 0 };
+		{
+			dispatcher lanes{ 4 };
+			for (int client{ 0 }; client<8; ++client) {
+				lanes.dispatch("client"+std::to_string(client), [&] {
+					const auto now = ++running;
+					for (auto seen = peak.load(); seen<now && not peak.compare_exchange_weak(seen, now);) {
+					}
+					// hold the lane until another one runs a task as well
+					const auto expiry = std::chrono::steady_clock::now()+2s;
+					while (peak.load()<2 && std::chrono::steady_clock::now()<expiry) {
+						std::this_thread::yield();
+					}
+					--running;
+				});
+			}
+		}
+		AGO_CHECK(peak.load()>=2);
+	}
+
+	void
+	evicted() {
+		std::atomic<bool> release{ false };
+		std::atomic<int> ran{ 0 };
+		{
+			dispatcher lanes{ 1 };
+			lanes.dispatch("a", [&] {
+				while (not release.load()) {
+					std::this_thread::yield();
+				}
+			});
+			for (int task{ 0 }; task<3; ++task) {
+				lanes.dispatch("a", [&] { ++ran; }, "first");
+			}
+			lanes.dispatch("b", [&] { ++ran; }, "second");
+			AGO_CHECK(lanes.evictOldest("second"));
+			AGO_CHECK(not lanes.evictOldest("second"));
+			AGO_CHECK(lanes.evict("a", "first")==3);
+			release = true;
+		}
+		AGO_CHECK(ran.load()==0);
+	}
+}
+
+int
+main() {
+	ordered();
+	parallel();
+	evicted();
+	return test::result();
+}
@@ -0,0 +1,96 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:19
+//
+
+#include <tests/check.h>
+#include <lib/network/envelope/envelope.h>
+
+using namespace agoNetwork;
+
+namespace {
+	void
+	encodeDecode() {
+		AGO_CHECK(envelope::encode({}).empty());
+		envelope::header header;
+		header.budget = 250;
+		header.request = 0x0102030405060708;
+		header.packed = 3;
+		header.compressed = 0x81;
+		header.stream = 7;
+		header.offset = 1u << 20;
+		header.total = 1u << 24;
+		header.credit = 2;
+		const auto frame = envelope::encode(header);
+		AGO_CHECK(static_cast<std::uint8_t>(frame[1])==envelope::version);
+		const auto decoded = envelope::decode(frame);
+		AGO_CHECK(decoded);
+		AGO_CHECK(decoded->budget==header.budget);
+		AGO_CHECK(decoded->request==header.request);
+		AGO_CHECK(decoded->packed==header.packed);
+		AGO_CHECK(decoded->compressed==header.compressed);
+		AGO_CHECK(decoded->stream==header.stream);
+		AGO_CHECK(decoded->offset==header.offset);
+		AGO_CHECK(decoded->total==header.total);
+		AGO_CHECK(decoded->credit==header.credit);
+	}
+
+	void
+	decodeMalformed() {
+		envelope::header header;
+		header.request = 42;
+		auto frame = envelope::encode(header);
+		// a message is not a header
+		AGO_CHECK(not envelope::decode("hello"));
+		AGO_CHECK(not envelope::decode(""));
+		// nor is a header of another version
+		auto other = frame;
+		other[1] = static_cast<char>(envelope::version+1);
+		AGO_CHECK(not envelope::decode(other));
+		// a truncated field makes the whole frame invalid
+		AGO_CHECK(not envelope::decode(frame.substr(0, frame.size()-1)));
+		// unknown fields are skipped
+		frame.append({ '\x7F', '\x02', 'a', 'b' });
+		const auto decoded = envelope::decode(frame);
+		AGO_CHECK(decoded && decoded->request==42u);
+	}
+
+	void
+	packUnpack() {
+		std::string frame;
+		const std::string large(300, 'x');
+		envelope::pack(frame, "first");
+		envelope::pack(frame, "");
+		envelope::pack(frame, large);
+		const auto messages = envelope::unpack(frame);
+		AGO_CHECK(messages.size()==3);
+		AGO_CHECK(messages[0]=="first");
+		AGO_CHECK(messages[1].empty());
+		AGO_CHECK(messages[2]==large);
+		// a truncated trailing message is dropped
+		const auto truncated = envelope::unpack(frame.substr(0, frame.size()-1));
+		AGO_CHECK(truncated.size()==2);
+		AGO_CHECK(envelope::unpack("").empty());
+	}
+
+	void
+	routeHops() {
+		// a direct peer keeps its identity as the address
+		AGO_CHECK(envelope::route({ "peer" })=="peer");
+		AGO_CHECK(envelope::hops("peer")==std::vector<std::string>{ "peer" });
+		const std::vector<std::string> frames{ "broker", "client" };
+		const auto address = envelope::route(frames);
+		AGO_CHECK(address.front()=='\0');
+		AGO_CHECK(envelope::hops(address)==frames);
+	}
+}
+
+int
+main() {
+	encodeDecode();
+	decodeMalformed();
+	packUnpack();
+	routeHops();
+	return test::result();
+}
@@ -0,0 +1,104 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:19
+//
+
+#include <array>
+#include <string>
+#include <tests/check.h>
+#include <lib/network/buffer/frameBuffer.h>
+
+namespace agoNetwork {
+	/// @brief Stands in for the socket, which is the only one that fills
+	/// a frame buffer.
+	class socket {
+	public:
+		static bool
+		append(frameBuffer& buffer, std::string_view frame) {
+			return buffer.append_(frame);
+		}
+
+		static void
+		pop(frameBuffer& buffer) {
+			buffer.pop_();
+		}
+
+		static void
+		drop(frameBuffer& buffer) {
+			buffer.drop_();
+		}
+
+		static void
+		swap(frameBuffer& buffer, std::size_t first, std::size_t second) {
+			buffer.swap_(first, second);
+		}
+	};
+}
+
+using namespace agoNetwork;
+
+namespace {
+	void
+	owned() {
+		frameBuffer buffer{ 4, 64 };
+		AGO_CHECK(buffer.empty());
+		AGO_CHECK(socket::append(buffer, "identity"));
+		AGO_CHECK(socket::append(buffer, ""));
+		AGO_CHECK(socket::append(buffer, "message"));
+		AGO_CHECK(buffer.size()==3);
+		AGO_CHECK(buffer.used()==15);
+		// the memory grows and the frames stay valid
+		AGO_CHECK(buffer.capacity()>=15);
+		AGO_CHECK(buffer.view(0)=="identity");
+		AGO_CHECK(buffer.view(1).empty());
+		AGO_CHECK(buffer.view(2)=="message");
+		AGO_CHECK(buffer[2].size()==7);
+		socket::pop(buffer);
+		AGO_CHECK(buffer.size()==2);
+		AGO_CHECK(buffer.used()==8);
+		socket::swap(buffer, 0, 1);
+		AGO_CHECK(buffer.view(0).empty());
+		AGO_CHECK(buffer.view(1)=="identity");
+		buffer.clear();
+		AGO_CHECK(buffer.empty() && buffer.used()==0);
+	}
+
+	void
+	limit() {
+		frameBuffer buffer{ 8, 16 };
+		AGO_CHECK(socket::append(buffer, "0123456789"));
+		// beyond the limit the message does not fit
+		AGO_CHECK(not socket::append(buffer, "0123456789"));
+		AGO_CHECK(buffer.truncated());
+		socket::drop(buffer);
+		AGO_CHECK(buffer.empty() && buffer.truncated());
+		buffer.clear();
+		AGO_CHECK(not buffer.truncated());
+		AGO_CHECK(not buffer.reserve(32));
+		AGO_CHECK(buffer.reserve(16));
+		buffer.shrink(4);
+		AGO_CHECK(buffer.capacity()==4);
+	}
+
+	void
+	callerMemory() {
+		std::array<std::byte, 8> memory{};
+		frameBuffer buffer{ memory };
+		AGO_CHECK(buffer.capacity()==8);
+		AGO_CHECK(socket::append(buffer, "abcd"));
+		AGO_CHECK(reinterpret_cast<const void*>(buffer[0].data())==memory.data());
+		// the memory of the caller never grows
+		AGO_CHECK(not socket::append(buffer, "efghi"));
+		AGO_CHECK(buffer.truncated());
+		AGO_CHECK(not buffer.reserve(16));
+	}
+}
+
+int
+main() {
+	owned();
+	limit();
+	callerMemory();
+	return test::result();
+}
@@ -0,0 +1,74 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 12:10
+//
+
+#include <tests/check.h>
+#include <lib/network/hedger/hedger.h>
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	void
+	budget() {
+		hedger _hedger{ 0.9, 0.25 };
+		// a single hedge is there to begin with
+		AGO_CHECK(_hedger.acquire());
+		AGO_CHECK(not _hedger.acquire());
+		AGO_CHECK(_hedger.stats().hedges==1 && _hedger.stats().denied==1);
+		// each request pays a quarter of the next one
+		for (int index{ 0 }; index<3; ++index) {
+			_hedger.request();
+			AGO_CHECK(not _hedger.acquire());
+		}
+		_hedger.request();
+		AGO_CHECK(_hedger.acquire());
+		AGO_CHECK(_hedger.stats().hedges==2 && _hedger.stats().denied==4);
+		// no more than ten hedges are saved for a burst
+		for (int index{ 0 }; index<100; ++index) {
+			_hedger.request();
+		}
+		for (int index{ 0 }; index<10; ++index) {
+			AGO_CHECK(_hedger.acquire());
+		}
+		AGO_CHECK(not _hedger.acquire());
+		AGO_CHECK(_hedger.stats().requests==104 && _hedger.stats().hedges==12);
+		_hedger.won();
+		AGO_CHECK(_hedger.stats().wins==1);
+		// nothing is ever hedged without a budget
+		hedger none{ 0.9, 0 };
+		AGO_CHECK(none.acquire());
+		for (int index{ 0 }; index<100; ++index) {
+			none.request();
+		}
+		AGO_CHECK(not none.acquire());
+	}
+
+	void
+	delay() {
+		hedger _hedger{ 0.9, 0.25 };
+		// too few round trips are observed to hedge at first
+		for (int index{ 1 }; index<16; ++index) {
+			_hedger.observe(std::chrono::microseconds{ index });
+		}
+		AGO_CHECK(not _hedger.request() && _hedger.stats().delay==0us);
+		for (int index{ 16 }; index<=100; ++index) {
+			_hedger.observe(std::chrono::microseconds{ index });
+		}
+		AGO_CHECK(_hedger.request()==90us && _hedger.stats().delay==90us);
+		// only the recent round trips count
+		for (int index{ 0 }; index<256; ++index) {
+			_hedger.observe(1000us);
+		}
+		AGO_CHECK(_hedger.request()==1000us);
+	}
+}
+
+int
+main() {
+	budget();
+	delay();
+	return test::result();
+}
@@ -0,0 +1,144 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 12:25
+//
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <tests/check.h>
+#include <lib/network/log/logger.h>
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	/// @brief Collects the lines of the logger instead of the standard error.
+	struct collector {
+		std::mutex mutex;
+		std::condition_variable released;
+		std::vector<std::string> lines;
+		/// The sink waits while it is held, so the ring of the test fills up.
+		bool held{ false };
+
+		collector() {
+			logger::output([this](logLevel, std::string_view line) {
+				std::unique_lock lock{ mutex };
+				released.wait(lock, [this] { return not held; });
+				lines.emplace_back(line);
+			});
+		}
+
+		~collector() {
+			logger::output({});
+		}
+
+		void
+		release() {
+			{
+				std::lock_guard lock{ mutex };
+				held = false;
+			}
+			released.notify_all();
+		}
+
+		std::vector<std::string>
+		take() {
+			std::lock_guard lock{ mutex };
+			return std::exchange(lines, {});
+		}
+	};
+
+	/// @brief A single call site of the logger.
+	void
+	site(int index) {
+		logger::warning("flooded {}", index);
+	}
+
+	void
+	suppressed() {
+		collector _collector;
+		logger::rateLimit(5);
+		const auto before = logger::stats();
+		for (int index{ 0 }; index<20; ++index) {
+			site(index);
+		}
+		// the rate of each call site is limited on its own
+		logger::warning("another site");
+		logger::flush();
+		auto lines = _collector.take();
+		AGO_CHECK(lines.size()==6);
+		AGO_CHECK(lines.front().ends_with("[warning] flooded 0"));
+		AGO_CHECK(lines.back().ends_with("[warning] another site"));
+		AGO_CHECK(logger::stats().suppressed-before.suppressed==15);
+		AGO_CHECK(logger::stats().written-before.written==6);
+		// the next record of the site once its second is over counts them
+		std::this_thread::sleep_for(1100ms);
+		site(20);
+		logger::flush();
+		lines = _collector.take();
+		AGO_CHECK(lines.size()==1);
+		AGO_CHECK(not lines.empty()
+				&& lines.front().ends_with("flooded 20 (15 similar records suppressed)"));
+		// and it is only counted once
+		site(21);
+		logger::flush();
+		lines = _collector.take();
+		AGO_CHECK(lines.size()==1 && lines.front().ends_with("flooded 21"));
+	}
+
+	void
+	dropped() {
+		collector _collector;
+		logger::rateLimit(0);
+		const auto before = logger::stats();
+		{
+			std::lock_guard lock{ _collector.mutex };
+			_collector.held = true;
+		}
+		// the sink holds the first record, so the ring of the thread (128
+		// records) fills up and the rest are dropped rather than waited for
+		for (int index{ 0 }; index<200; ++index) {
+			logger::error("record {} of {}", index, "dropped");
+		}
+		AGO_CHECK(logger::stats().dropped-before.dropped==72);
+		_collector.release();
+		logger::flush();
+		const auto lines = _collector.take();
+		AGO_CHECK(lines.size()==128);
+		AGO_CHECK(not lines.empty() && lines.back().ends_with("[error] record 127 of dropped"));
+		AGO_CHECK(logger::stats().written-before.written==128);
+		AGO_CHECK(logger::stats().suppressed==before.suppressed);
+		// the ring is empty again once it is written out
+		logger::error("after");
+		logger::flush();
+		AGO_CHECK(_collector.take().size()==1);
+		AGO_CHECK(logger::stats().dropped-before.dropped==72);
+	}
+
+	void
+	levels() {
+		collector _collector;
+		const auto before = logger::stats();
+		AGO_CHECK(logger::level()==logLevel::warning);
+		AGO_CHECK(not logger::enabled(logLevel::info) && logger::enabled(logLevel::error));
+		logger::info("not logged");
+		logger::level(logLevel::off);
+		logger::error("not logged either");
+		logger::level(logLevel::warning);
+		logger::flush();
+		AGO_CHECK(_collector.take().empty());
+		AGO_CHECK(logger::stats().written==before.written);
+	}
+}
+
+int
+main() {
+	levels();
+	suppressed();
+	dropped();
+	return test::result();
+}
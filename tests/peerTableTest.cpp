@@ -0,0 +1,81 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:19
+//
+
+#include <algorithm>
+#include <tests/check.h>
+#include <lib/network/peers/peerTable.h>
+
+using namespace agoNetwork;
+
+namespace {
+	void
+	touchPushErase() {
+		peerTable table;
+		AGO_CHECK(table.touch("a"));
+		AGO_CHECK(not table.touch("a"));
+		AGO_CHECK(table.pushed("a"));
+		AGO_CHECK(not table.pushed("b"));
+		const auto peer = table.find("a");
+		AGO_CHECK(peer && peer->received==2 && peer->pushed==1);
+		AGO_CHECK(table.size()==1);
+		AGO_CHECK(table.erase("a"));
+		AGO_CHECK(not table.erase("a"));
+		AGO_CHECK(not table.find("a"));
+		AGO_CHECK(table.size()==0);
+	}
+
+	void
+	toggle() {
+		peerTable table;
+		// the connect and the disconnect notifications look the same
+		AGO_CHECK(table.toggle("a")==true);
+		AGO_CHECK(table.toggle("a")==false);
+		AGO_CHECK(table.size()==0);
+	}
+
+	void
+	evict() {
+		peerTable table;
+		table.toggle("silent");
+		table.touch("busy");
+		auto evicted = table.evict(peerTable::clock::now()+std::chrono::seconds{ 1 });
+		std::sort(evicted.begin(), evicted.end());
+		AGO_CHECK((evicted==std::vector<std::string>{ "busy", "silent" }));
+		AGO_CHECK(table.size()==0);
+		// the disconnect of an evicted peer keeps the notifications in phase
+		AGO_CHECK(not table.toggle("silent").has_value());
+		AGO_CHECK(table.toggle("silent")==true);
+		// a message of an evicted peer brings it back
+		AGO_CHECK(table.touch("busy"));
+		AGO_CHECK(table.toggle("busy")==false);
+	}
+
+	void
+	growShrink() {
+		peerTable table{ 16 };
+		for (int peer{ 0 }; peer<1000; ++peer) {
+			table.touch("peer"+std::to_string(peer));
+		}
+		AGO_CHECK(table.size()==1000);
+		AGO_CHECK(table.identities().size()==1000);
+		for (int peer{ 0 }; peer<990; ++peer) {
+			AGO_CHECK(table.erase("peer"+std::to_string(peer)));
+		}
+		AGO_CHECK(table.size()==10);
+		for (int peer{ 990 }; peer<1000; ++peer) {
+			AGO_CHECK(table.find("peer"+std::to_string(peer)));
+		}
+	}
+}
+
+int
+main() {
+	touchPushErase();
+	toggle();
+	evict();
+	growShrink();
+	return test::result();
+}
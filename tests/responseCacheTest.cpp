@@ -0,0 +1,69 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:19
+//
+
+#include <thread>
+#include <tests/check.h>
+#include <lib/network/cache/responseCache.h>
+
+using namespace agoNetwork;
+using namespace std::chrono_literals;
+
+namespace {
+	void
+	storeLookup() {
+		responseCache cache{ 1min, 1024 };
+		AGO_CHECK(not cache.lookup("key"));
+		cache.store("key", { "one", "two" });
+		const auto replies = cache.lookup("key");
+		AGO_CHECK((replies==std::vector<std::string>{ "one", "two" }));
+		const auto stats = cache.stats();
+		AGO_CHECK(stats.hits==1 && stats.misses==1);
+		AGO_CHECK(stats.bytes==3+3+3);
+		AGO_CHECK(stats.hitRate()==0.5);
+		// storing a key again replaces its replies
+		cache.store("key", { "three" });
+		AGO_CHECK((cache.lookup("key")==std::vector<std::string>{ "three" }));
+		AGO_CHECK(cache.stats().bytes==3+5);
+	}
+
+	void
+	expiry() {
+		responseCache cache{ 1ms, 1024 };
+		cache.store("key", { "reply" });
+		std::this_thread::sleep_for(5ms);
+		AGO_CHECK(not cache.lookup("key"));
+		AGO_CHECK(cache.stats().bytes==0);
+	}
+
+	void
+	budget() {
+		// each entry holds two bytes of key and eight of reply
+		responseCache cache{ 1min, 30 };
+		cache.store("k1", { "reply-01" });
+		cache.store("k2", { "reply-02" });
+		cache.store("k3", { "reply-03" });
+		// k1 is now the most recently used, so k2 is evicted
+		AGO_CHECK(cache.lookup("k1"));
+		cache.store("k4", { "reply-04" });
+		AGO_CHECK(cache.lookup("k1"));
+		AGO_CHECK(not cache.lookup("k2"));
+		AGO_CHECK(cache.lookup("k3"));
+		AGO_CHECK(cache.lookup("k4"));
+		AGO_CHECK(cache.stats().evictions==1);
+		// an entry bigger than the budget is not kept
+		cache.store("big", { std::string(64, 'x') });
+		AGO_CHECK(not cache.lookup("big"));
+		AGO_CHECK(cache.lookup("k4"));
+	}
+}
+
+int
+main() {
+	storeLookup();
+	expiry();
+	budget();
+	return test::result();
+}
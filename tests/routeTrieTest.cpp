@@ -0,0 +1,67 @@
+//
+// Created by agent on 10/18/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/18/26 21:19
+//
+
+#include <cstdint>
+#include <tests/check.h>
+#include <lib/network/routing/routeTrie.h>
+
+using namespace agoNetwork;
+
+namespace {
+	void
+	longestPrefix() {
+		routeTrie trie;
+		const auto order = trie.insert("order");
+		const auto created = trie.insert("order.created");
+		const auto orders = trie.insert("orders");
+		const auto user = trie.insert("user");
+		// an inserted route keeps its index
+		AGO_CHECK(trie.insert("order")==order);
+		AGO_CHECK(trie.size()==4);
+		trie.build();
+		AGO_CHECK(trie.match("order")==order);
+		AGO_CHECK(trie.match("order.updated")==order);
+		AGO_CHECK(trie.match("order.created.eu")==created);
+		AGO_CHECK(trie.match("orders/1")==orders);
+		AGO_CHECK(trie.match("user:1")==user);
+		AGO_CHECK(not trie.match("ord"));
+		AGO_CHECK(not trie.match("payment"));
+		AGO_CHECK(not trie.match(""));
+	}
+
+	void
+	unbuilt() {
+		routeTrie trie;
+		trie.insert("a");
+		// an insertion invalidates the trie until it is built
+		AGO_CHECK(not trie.match("a"));
+		trie.build();
+		AGO_CHECK(trie.match("a")==0u);
+		trie.insert("b");
+		AGO_CHECK(not trie.match("b"));
+	}
+
+	void
+	typeIds() {
+		routeTrie trie;
+		const auto first = trie.insert(typeRoute(std::uint16_t{ 1 }));
+		const auto second = trie.insert(typeRoute(std::uint16_t{ 2 }));
+		trie.build();
+		auto message = typeRoute(std::uint16_t{ 2 });
+		message.append("payload");
+		AGO_CHECK(trie.match(message)==second);
+		AGO_CHECK(trie.match(typeRoute(std::uint16_t{ 1 }))==first);
+		AGO_CHECK(not trie.match(typeRoute(std::uint16_t{ 3 })));
+	}
+}
+
+int
+main() {
+	longestPrefix();
+	unbuilt();
+	typeIds();
+	return test::result();
+}
@@ -0,0 +1,72 @@
+//
+// Created by agent on 10/19/26.
+// Copyright (c) 2026. All rights reserved.
+// Last edit on 10/19/26 12:40
+//
+
+#include <thread>
+#include <vector>
+#include <tests/check.h>
+#include <lib/network/dealer/sharedDealer.h>
+
+using namespace agoNetwork;
+
+namespace {
+	void
+	perThread() {
+		auto context = std::make_shared<zmq::context_t>(1);
+		sharedDealer shared{ context, socketModel::inproc{ "shared", "shared" }};
+		auto* own = &shared.local();
+		AGO_CHECK(&shared.local()==own && shared.threads()==1);
+		constexpr std::size_t count{ 4 };
+		std::vector<dealer*> dealers(count, nullptr);
+		std::vector<bool> same(count, false);
+		{
+			std::vector<std::thread> threads;
+			for (std::size_t index{ 0 }; index<count; ++index) {
+				threads.emplace_back([&shared, &dealers, &same, index] {
+					dealers[index] = &shared.local();
+					same[index] = &shared.local()==dealers[index];
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+		}
+		// each thread got a dealer of its own, and it is closed once the
+		// thread exits
+		for (std::size_t index{ 0 }; index<count; ++index) {
+			AGO_CHECK(same[index] && dealers[index]!=own);
+			for (std::size_t other{ 0 }; other<index; ++other) {
+				AGO_CHECK(dealers[index]!=dealers[other]);
+			}
+		}
+		AGO_CHECK(shared.threads()==1);
+	}
+
+	void
+	outlived() {
+		auto context = std::make_shared<zmq::context_t>(1);
+		std::size_t threads{ 0 };
+		// the thread outlives the shared dealers it used
+		std::thread thread{ [&] {
+			for (int index{ 0 }; index<8; ++index) {
+				sharedDealer shared{ context, socketModel::inproc{ "outlived", "outlived" }};
+				shared.local();
+				threads += shared.threads();
+			}
+			sharedDealer last{ context, socketModel::inproc{ "outlived", "outlived" }};
+			last.local();
+			threads += last.threads();
+		}};
+		thread.join();
+		AGO_CHECK(threads==9);
+	}
+}
+
+int
+main() {
+	perThread();
+	outlived();
+	return test::result();
+}